@@ -0,0 +1,140 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/codec/CMakeLists.txt"
+  "/root/repo/imgproc/CMakeLists.txt"
+  "/root/repo/test/CMakeLists.txt"
+  "/root/repo/test/benchmark/CMakeLists.txt"
+  "/root/repo/test/unit/CMakeLists.txt"
+  "/tmp/shim/bench/CMakeLists.txt"
+  "/tmp/shim/eigen/CMakeLists.txt"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkTargets-none.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FetchContent.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython/Support.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/GoogleTest.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/src/googletest/CMakeLists.txt"
+  "/usr/src/googletest/googlemock/CMakeLists.txt"
+  "/usr/src/googletest/googlemock/cmake/gmock.pc.in"
+  "/usr/src/googletest/googlemock/cmake/gmock_main.pc.in"
+  "/usr/src/googletest/googletest/CMakeLists.txt"
+  "/usr/src/googletest/googletest/cmake/Config.cmake.in"
+  "/usr/src/googletest/googletest/cmake/gtest.pc.in"
+  "/usr/src/googletest/googletest/cmake/gtest_main.pc.in"
+  "/usr/src/googletest/googletest/cmake/internal_utils.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "_deps/eigen-build/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "codec/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "imgproc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "DartConfiguration.tcl"
+  "test/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "_deps/googletest-build/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "_deps/googletest-build/googletest/generated/gmock.pc"
+  "_deps/googletest-build/googletest/generated/gmock_main.pc"
+  "_deps/googletest-build/googlemock/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "_deps/googletest-build/googletest/generated/GTestConfigVersion.cmake"
+  "_deps/googletest-build/googletest/generated/GTestConfig.cmake"
+  "_deps/googletest-build/googletest/generated/gtest.pc"
+  "_deps/googletest-build/googletest/generated/gtest_main.pc"
+  "_deps/googletest-build/googletest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/benchmark/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "_deps/googlebenchmark-build/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "codec/CMakeFiles/codec.dir/DependInfo.cmake"
+  "imgproc/CMakeFiles/imgproc.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/run_unit_test.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "_deps/googletest-build/googlemock/CMakeFiles/gmock.dir/DependInfo.cmake"
+  "_deps/googletest-build/googlemock/CMakeFiles/gmock_main.dir/DependInfo.cmake"
+  "_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "test/benchmark/CMakeFiles/run_benchmark.dir/DependInfo.cmake"
+  )
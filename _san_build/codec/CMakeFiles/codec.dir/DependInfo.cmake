@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/codec/rle_mmr.cpp" "codec/CMakeFiles/codec.dir/rle_mmr.cpp.o" "gcc" "codec/CMakeFiles/codec.dir/rle_mmr.cpp.o.d"
+  "/root/repo/codec/rle_multi.cpp" "codec/CMakeFiles/codec.dir/rle_multi.cpp.o" "gcc" "codec/CMakeFiles/codec.dir/rle_multi.cpp.o.d"
+  "/root/repo/codec/rle_v1.cpp" "codec/CMakeFiles/codec.dir/rle_v1.cpp.o" "gcc" "codec/CMakeFiles/codec.dir/rle_v1.cpp.o.d"
+  "/root/repo/codec/rle_v2.cpp" "codec/CMakeFiles/codec.dir/rle_v2.cpp.o" "gcc" "codec/CMakeFiles/codec.dir/rle_v2.cpp.o.d"
+  "/root/repo/codec/rle_v2_batch.cpp" "codec/CMakeFiles/codec.dir/rle_v2_batch.cpp.o" "gcc" "codec/CMakeFiles/codec.dir/rle_v2_batch.cpp.o.d"
+  "/root/repo/codec/rle_v2_framed.cpp" "codec/CMakeFiles/codec.dir/rle_v2_framed.cpp.o" "gcc" "codec/CMakeFiles/codec.dir/rle_v2_framed.cpp.o.d"
+  "/root/repo/codec/rle_v3.cpp" "codec/CMakeFiles/codec.dir/rle_v3.cpp.o" "gcc" "codec/CMakeFiles/codec.dir/rle_v3.cpp.o.d"
+  "/root/repo/codec/rle_v4.cpp" "codec/CMakeFiles/codec.dir/rle_v4.cpp.o" "gcc" "codec/CMakeFiles/codec.dir/rle_v4.cpp.o.d"
+  "/root/repo/codec/thread_pool.cpp" "codec/CMakeFiles/codec.dir/thread_pool.cpp.o" "gcc" "codec/CMakeFiles/codec.dir/thread_pool.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
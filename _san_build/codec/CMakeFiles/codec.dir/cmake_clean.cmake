@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/codec.dir/rle_mmr.cpp.o"
+  "CMakeFiles/codec.dir/rle_mmr.cpp.o.d"
+  "CMakeFiles/codec.dir/rle_multi.cpp.o"
+  "CMakeFiles/codec.dir/rle_multi.cpp.o.d"
+  "CMakeFiles/codec.dir/rle_v1.cpp.o"
+  "CMakeFiles/codec.dir/rle_v1.cpp.o.d"
+  "CMakeFiles/codec.dir/rle_v2.cpp.o"
+  "CMakeFiles/codec.dir/rle_v2.cpp.o.d"
+  "CMakeFiles/codec.dir/rle_v2_batch.cpp.o"
+  "CMakeFiles/codec.dir/rle_v2_batch.cpp.o.d"
+  "CMakeFiles/codec.dir/rle_v2_framed.cpp.o"
+  "CMakeFiles/codec.dir/rle_v2_framed.cpp.o.d"
+  "CMakeFiles/codec.dir/rle_v3.cpp.o"
+  "CMakeFiles/codec.dir/rle_v3.cpp.o.d"
+  "CMakeFiles/codec.dir/rle_v4.cpp.o"
+  "CMakeFiles/codec.dir/rle_v4.cpp.o.d"
+  "CMakeFiles/codec.dir/thread_pool.cpp.o"
+  "CMakeFiles/codec.dir/thread_pool.cpp.o.d"
+  "libcodec.a"
+  "libcodec.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/codec.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
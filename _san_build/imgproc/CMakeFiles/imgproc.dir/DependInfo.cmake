@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/imgproc/mask_log.cpp" "imgproc/CMakeFiles/imgproc.dir/mask_log.cpp.o" "gcc" "imgproc/CMakeFiles/imgproc.dir/mask_log.cpp.o.d"
+  "/root/repo/imgproc/morphology.cpp" "imgproc/CMakeFiles/imgproc.dir/morphology.cpp.o" "gcc" "imgproc/CMakeFiles/imgproc.dir/morphology.cpp.o.d"
+  "/root/repo/imgproc/row_index.cpp" "imgproc/CMakeFiles/imgproc.dir/row_index.cpp.o" "gcc" "imgproc/CMakeFiles/imgproc.dir/row_index.cpp.o.d"
+  "/root/repo/imgproc/sparse_image.cpp" "imgproc/CMakeFiles/imgproc.dir/sparse_image.cpp.o" "gcc" "imgproc/CMakeFiles/imgproc.dir/sparse_image.cpp.o.d"
+  "/root/repo/imgproc/sparse_image_file.cpp" "imgproc/CMakeFiles/imgproc.dir/sparse_image_file.cpp.o" "gcc" "imgproc/CMakeFiles/imgproc.dir/sparse_image_file.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_san_build/codec/CMakeFiles/codec.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/imgproc.dir/mask_log.cpp.o"
+  "CMakeFiles/imgproc.dir/mask_log.cpp.o.d"
+  "CMakeFiles/imgproc.dir/morphology.cpp.o"
+  "CMakeFiles/imgproc.dir/morphology.cpp.o.d"
+  "CMakeFiles/imgproc.dir/row_index.cpp.o"
+  "CMakeFiles/imgproc.dir/row_index.cpp.o.d"
+  "CMakeFiles/imgproc.dir/sparse_image.cpp.o"
+  "CMakeFiles/imgproc.dir/sparse_image.cpp.o.d"
+  "CMakeFiles/imgproc.dir/sparse_image_file.cpp.o"
+  "CMakeFiles/imgproc.dir/sparse_image_file.cpp.o.d"
+  "libimgproc.a"
+  "libimgproc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/imgproc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
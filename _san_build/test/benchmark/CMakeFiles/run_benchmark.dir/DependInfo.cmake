@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/benchmark/codec_benchmark.cpp" "test/benchmark/CMakeFiles/run_benchmark.dir/codec_benchmark.cpp.o" "gcc" "test/benchmark/CMakeFiles/run_benchmark.dir/codec_benchmark.cpp.o.d"
+  "/root/repo/test/benchmark/leb128_benchmark.cpp" "test/benchmark/CMakeFiles/run_benchmark.dir/leb128_benchmark.cpp.o" "gcc" "test/benchmark/CMakeFiles/run_benchmark.dir/leb128_benchmark.cpp.o.d"
+  "/root/repo/test/benchmark/rle_benchmark.cpp" "test/benchmark/CMakeFiles/run_benchmark.dir/rle_benchmark.cpp.o" "gcc" "test/benchmark/CMakeFiles/run_benchmark.dir/rle_benchmark.cpp.o.d"
+  "/root/repo/test/benchmark/sparse_image_benchmark.cpp" "test/benchmark/CMakeFiles/run_benchmark.dir/sparse_image_benchmark.cpp.o" "gcc" "test/benchmark/CMakeFiles/run_benchmark.dir/sparse_image_benchmark.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_san_build/imgproc/CMakeFiles/imgproc.dir/DependInfo.cmake"
+  "/root/repo/_san_build/codec/CMakeFiles/codec.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_benchmark.dir/codec_benchmark.cpp.o"
+  "CMakeFiles/run_benchmark.dir/codec_benchmark.cpp.o.d"
+  "CMakeFiles/run_benchmark.dir/leb128_benchmark.cpp.o"
+  "CMakeFiles/run_benchmark.dir/leb128_benchmark.cpp.o.d"
+  "CMakeFiles/run_benchmark.dir/rle_benchmark.cpp.o"
+  "CMakeFiles/run_benchmark.dir/rle_benchmark.cpp.o.d"
+  "CMakeFiles/run_benchmark.dir/sparse_image_benchmark.cpp.o"
+  "CMakeFiles/run_benchmark.dir/sparse_image_benchmark.cpp.o.d"
+  "run_benchmark"
+  "run_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,41 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/unit/bit_packed_test.cpp" "test/unit/CMakeFiles/run_unit_test.dir/bit_packed_test.cpp.o" "gcc" "test/unit/CMakeFiles/run_unit_test.dir/bit_packed_test.cpp.o.d"
+  "/root/repo/test/unit/bit_stream_test.cpp" "test/unit/CMakeFiles/run_unit_test.dir/bit_stream_test.cpp.o" "gcc" "test/unit/CMakeFiles/run_unit_test.dir/bit_stream_test.cpp.o.d"
+  "/root/repo/test/unit/experiments.cpp" "test/unit/CMakeFiles/run_unit_test.dir/experiments.cpp.o" "gcc" "test/unit/CMakeFiles/run_unit_test.dir/experiments.cpp.o.d"
+  "/root/repo/test/unit/leb128_test.cpp" "test/unit/CMakeFiles/run_unit_test.dir/leb128_test.cpp.o" "gcc" "test/unit/CMakeFiles/run_unit_test.dir/leb128_test.cpp.o.d"
+  "/root/repo/test/unit/mask_log_test.cpp" "test/unit/CMakeFiles/run_unit_test.dir/mask_log_test.cpp.o" "gcc" "test/unit/CMakeFiles/run_unit_test.dir/mask_log_test.cpp.o.d"
+  "/root/repo/test/unit/morphology_test.cpp" "test/unit/CMakeFiles/run_unit_test.dir/morphology_test.cpp.o" "gcc" "test/unit/CMakeFiles/run_unit_test.dir/morphology_test.cpp.o.d"
+  "/root/repo/test/unit/rle_mmr_test.cpp" "test/unit/CMakeFiles/run_unit_test.dir/rle_mmr_test.cpp.o" "gcc" "test/unit/CMakeFiles/run_unit_test.dir/rle_mmr_test.cpp.o.d"
+  "/root/repo/test/unit/rle_multi_test.cpp" "test/unit/CMakeFiles/run_unit_test.dir/rle_multi_test.cpp.o" "gcc" "test/unit/CMakeFiles/run_unit_test.dir/rle_multi_test.cpp.o.d"
+  "/root/repo/test/unit/rle_v1_test.cpp" "test/unit/CMakeFiles/run_unit_test.dir/rle_v1_test.cpp.o" "gcc" "test/unit/CMakeFiles/run_unit_test.dir/rle_v1_test.cpp.o.d"
+  "/root/repo/test/unit/rle_v2_batch_test.cpp" "test/unit/CMakeFiles/run_unit_test.dir/rle_v2_batch_test.cpp.o" "gcc" "test/unit/CMakeFiles/run_unit_test.dir/rle_v2_batch_test.cpp.o.d"
+  "/root/repo/test/unit/rle_v2_framed_test.cpp" "test/unit/CMakeFiles/run_unit_test.dir/rle_v2_framed_test.cpp.o" "gcc" "test/unit/CMakeFiles/run_unit_test.dir/rle_v2_framed_test.cpp.o.d"
+  "/root/repo/test/unit/rle_v2_test.cpp" "test/unit/CMakeFiles/run_unit_test.dir/rle_v2_test.cpp.o" "gcc" "test/unit/CMakeFiles/run_unit_test.dir/rle_v2_test.cpp.o.d"
+  "/root/repo/test/unit/rle_v3_test.cpp" "test/unit/CMakeFiles/run_unit_test.dir/rle_v3_test.cpp.o" "gcc" "test/unit/CMakeFiles/run_unit_test.dir/rle_v3_test.cpp.o.d"
+  "/root/repo/test/unit/rle_v4_test.cpp" "test/unit/CMakeFiles/run_unit_test.dir/rle_v4_test.cpp.o" "gcc" "test/unit/CMakeFiles/run_unit_test.dir/rle_v4_test.cpp.o.d"
+  "/root/repo/test/unit/row_index_test.cpp" "test/unit/CMakeFiles/run_unit_test.dir/row_index_test.cpp.o" "gcc" "test/unit/CMakeFiles/run_unit_test.dir/row_index_test.cpp.o.d"
+  "/root/repo/test/unit/sparse_image_file_test.cpp" "test/unit/CMakeFiles/run_unit_test.dir/sparse_image_file_test.cpp.o" "gcc" "test/unit/CMakeFiles/run_unit_test.dir/sparse_image_file_test.cpp.o.d"
+  "/root/repo/test/unit/sparse_image_test.cpp" "test/unit/CMakeFiles/run_unit_test.dir/sparse_image_test.cpp.o" "gcc" "test/unit/CMakeFiles/run_unit_test.dir/sparse_image_test.cpp.o.d"
+  "/root/repo/test/unit/thread_pool_test.cpp" "test/unit/CMakeFiles/run_unit_test.dir/thread_pool_test.cpp.o" "gcc" "test/unit/CMakeFiles/run_unit_test.dir/thread_pool_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_san_build/codec/CMakeFiles/codec.dir/DependInfo.cmake"
+  "/root/repo/_san_build/imgproc/CMakeFiles/imgproc.dir/DependInfo.cmake"
+  "/root/repo/_san_build/_deps/googletest-build/googlemock/CMakeFiles/gmock.dir/DependInfo.cmake"
+  "/root/repo/_san_build/_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_san_build/_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,46 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_unit_test.dir/bit_packed_test.cpp.o"
+  "CMakeFiles/run_unit_test.dir/bit_packed_test.cpp.o.d"
+  "CMakeFiles/run_unit_test.dir/bit_stream_test.cpp.o"
+  "CMakeFiles/run_unit_test.dir/bit_stream_test.cpp.o.d"
+  "CMakeFiles/run_unit_test.dir/experiments.cpp.o"
+  "CMakeFiles/run_unit_test.dir/experiments.cpp.o.d"
+  "CMakeFiles/run_unit_test.dir/leb128_test.cpp.o"
+  "CMakeFiles/run_unit_test.dir/leb128_test.cpp.o.d"
+  "CMakeFiles/run_unit_test.dir/mask_log_test.cpp.o"
+  "CMakeFiles/run_unit_test.dir/mask_log_test.cpp.o.d"
+  "CMakeFiles/run_unit_test.dir/morphology_test.cpp.o"
+  "CMakeFiles/run_unit_test.dir/morphology_test.cpp.o.d"
+  "CMakeFiles/run_unit_test.dir/rle_mmr_test.cpp.o"
+  "CMakeFiles/run_unit_test.dir/rle_mmr_test.cpp.o.d"
+  "CMakeFiles/run_unit_test.dir/rle_multi_test.cpp.o"
+  "CMakeFiles/run_unit_test.dir/rle_multi_test.cpp.o.d"
+  "CMakeFiles/run_unit_test.dir/rle_v1_test.cpp.o"
+  "CMakeFiles/run_unit_test.dir/rle_v1_test.cpp.o.d"
+  "CMakeFiles/run_unit_test.dir/rle_v2_batch_test.cpp.o"
+  "CMakeFiles/run_unit_test.dir/rle_v2_batch_test.cpp.o.d"
+  "CMakeFiles/run_unit_test.dir/rle_v2_framed_test.cpp.o"
+  "CMakeFiles/run_unit_test.dir/rle_v2_framed_test.cpp.o.d"
+  "CMakeFiles/run_unit_test.dir/rle_v2_test.cpp.o"
+  "CMakeFiles/run_unit_test.dir/rle_v2_test.cpp.o.d"
+  "CMakeFiles/run_unit_test.dir/rle_v3_test.cpp.o"
+  "CMakeFiles/run_unit_test.dir/rle_v3_test.cpp.o.d"
+  "CMakeFiles/run_unit_test.dir/rle_v4_test.cpp.o"
+  "CMakeFiles/run_unit_test.dir/rle_v4_test.cpp.o.d"
+  "CMakeFiles/run_unit_test.dir/row_index_test.cpp.o"
+  "CMakeFiles/run_unit_test.dir/row_index_test.cpp.o.d"
+  "CMakeFiles/run_unit_test.dir/sparse_image_file_test.cpp.o"
+  "CMakeFiles/run_unit_test.dir/sparse_image_file_test.cpp.o.d"
+  "CMakeFiles/run_unit_test.dir/sparse_image_test.cpp.o"
+  "CMakeFiles/run_unit_test.dir/sparse_image_test.cpp.o.d"
+  "CMakeFiles/run_unit_test.dir/thread_pool_test.cpp.o"
+  "CMakeFiles/run_unit_test.dir/thread_pool_test.cpp.o.d"
+  "run_unit_test"
+  "run_unit_test.pdb"
+  "run_unit_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_unit_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
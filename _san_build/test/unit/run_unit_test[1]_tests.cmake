@@ -0,0 +1,265 @@
+add_test([=[MaskLogTest.append_read]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=MaskLogTest.append_read]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MaskLogTest.append_read]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MaskLogTest.reopen_append]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=MaskLogTest.reopen_append]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MaskLogTest.reopen_append]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MaskLogTest.frame_outlives_refresh]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=MaskLogTest.frame_outlives_refresh]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MaskLogTest.frame_outlives_refresh]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MaskLogTest.concurrent_readers]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=MaskLogTest.concurrent_readers]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MaskLogTest.concurrent_readers]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MaskLogTest.open__missing]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=MaskLogTest.open__missing]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MaskLogTest.open__missing]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Morphology.dilate]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=Morphology.dilate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Morphology.dilate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Morphology.erode__border_is_neutral]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=Morphology.erode__border_is_neutral]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Morphology.erode__border_is_neutral]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Morphology.opening_and_closing_bound_the_mask]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=Morphology.opening_and_closing_bound_the_mask]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Morphology.opening_and_closing_bound_the_mask]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Morphology.matches_reference]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=Morphology.matches_reference]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Morphology.matches_reference]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Morphology.encodes_like_sparse_image]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=Morphology.encodes_like_sparse_image]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Morphology.encodes_like_sparse_image]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Morphology.structuring_element_sizes]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=Morphology.structuring_element_sizes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Morphology.structuring_element_sizes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_mmr.encode_decode__all_zeros]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_mmr.encode_decode__all_zeros]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_mmr.encode_decode__all_zeros]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_mmr.encode_decode__blobs]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_mmr.encode_decode__blobs]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_mmr.encode_decode__blobs]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_mmr.encode_decode__noise]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_mmr.encode_decode__noise]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_mmr.encode_decode__noise]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_mmr.encode_decode__narrow]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_mmr.encode_decode__narrow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_mmr.encode_decode__narrow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_mmr.max_encoded_size]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_mmr.max_encoded_size]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_mmr.max_encoded_size]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_mmr.encode__bad_width]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_mmr.encode__bad_width]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_mmr.encode__bad_width]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_mmr.decode__truncated]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_mmr.decode__truncated]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_mmr.decode__truncated]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RowIndex.seek_points]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=RowIndex.seek_points]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RowIndex.seek_points]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RowIndex.stride]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=RowIndex.stride]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RowIndex.stride]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RowIndex.padding]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=RowIndex.padding]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RowIndex.padding]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RowIndex.copy_move]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=RowIndex.copy_move]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RowIndex.copy_move]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_multi.encode__u8]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_multi.encode__u8]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_multi.encode__u8]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_multi.encode_decode__u8]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_multi.encode_decode__u8]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_multi.encode_decode__u8]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_multi.encode_decode__u16]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_multi.encode_decode__u16]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_multi.encode_decode__u16]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_multi.max_encoded_size]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_multi.max_encoded_size]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_multi.max_encoded_size]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_multi.decode__value_out_of_range]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_multi.decode__value_out_of_range]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_multi.decode__value_out_of_range]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle.encode]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle.encode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle.encode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle.encode_decode]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle.encode_decode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle.encode_decode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle.encode_decode_sparse]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle.encode_decode_sparse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle.encode_decode_sparse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle.encode_decode_sparse_small]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle.encode_decode_sparse_small]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle.encode_decode_sparse_small]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle.encode_decode__bit_packed]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle.encode_decode__bit_packed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle.encode_decode__bit_packed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v2.encode__all_zeros]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v2.encode__all_zeros]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v2.encode__all_zeros]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v2.encode__v_u8_10]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v2.encode__v_u8_10]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v2.encode__v_u8_10]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v2.encode__a_u8_2x3]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v2.encode__a_u8_2x3]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v2.encode__a_u8_2x3]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v2.encode__runs_across_simd_blocks]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v2.encode__runs_across_simd_blocks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v2.encode__runs_across_simd_blocks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v2.encode__long_runs]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v2.encode__long_runs]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v2.encode__long_runs]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v2.encoded_size]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v2.encoded_size]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v2.encoded_size]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v2.max_encoded_size]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v2.max_encoded_size]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v2.max_encoded_size]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v2.encode_decode]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v2.encode_decode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v2.encode_decode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v2.encode_decode_sparse]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v2.encode_decode_sparse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v2.encode_decode_sparse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v2.encode_decode_sparse_small]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v2.encode_decode_sparse_small]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v2.encode_decode_sparse_small]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v2.Encoder__matches_one_shot]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v2.Encoder__matches_one_shot]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v2.Encoder__matches_one_shot]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v2.Decoder__matches_one_shot]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v2.Decoder__matches_one_shot]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v2.Decoder__matches_one_shot]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v2.encode_decode__bit_packed]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v2.encode_decode__bit_packed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v2.encode_decode__bit_packed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v2.stats]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v2.stats]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v2.stats]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v2.stats__random]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v2.stats__random]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v2.stats__random]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v2.append_run]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v2.append_run]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v2.append_run]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v2_batch.encode_decode]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v2_batch.encode_decode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v2_batch.encode_decode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v2_batch.encode_decode__thread_pool]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v2_batch.encode_decode__thread_pool]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v2_batch.encode_decode__thread_pool]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v2_batch.encode__arena_too_small]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v2_batch.encode__arena_too_small]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v2_batch.encode__arena_too_small]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v2_batch.bad_offsets]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v2_batch.bad_offsets]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v2_batch.bad_offsets]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v2_framed.encode_decode]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v2_framed.encode_decode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v2_framed.encode_decode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v2_framed.encode_decode__thread_pool]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v2_framed.encode_decode__thread_pool]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v2_framed.encode_decode__thread_pool]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v2_framed.band_start_values]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v2_framed.band_start_values]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v2_framed.band_start_values]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v2_framed.decode__buffer_too_small]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v2_framed.decode__buffer_too_small]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v2_framed.decode__buffer_too_small]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v3.encode__all_zeros]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v3.encode__all_zeros]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v3.encode__all_zeros]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v3.encode__v_u8_10]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v3.encode__v_u8_10]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v3.encode__v_u8_10]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v3.encode__multi_byte_lengths]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v3.encode__multi_byte_lengths]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v3.encode__multi_byte_lengths]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v3.encode_decode]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v3.encode_decode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v3.encode_decode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v3.max_encoded_size]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v3.max_encoded_size]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v3.max_encoded_size]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v3.decode__truncated]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v3.decode__truncated]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v3.decode__truncated]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v4.encode_decode__all_zeros]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v4.encode_decode__all_zeros]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v4.encode_decode__all_zeros]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v4.encode_decode]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v4.encode_decode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v4.encode_decode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v4.encode_decode__long_runs]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v4.encode_decode__long_runs]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v4.encode_decode__long_runs]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v4.max_encoded_size]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v4.max_encoded_size]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v4.max_encoded_size]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[rle_v4.decode__truncated]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=rle_v4.decode__truncated]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[rle_v4.decode__truncated]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LEB128.encode]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=LEB128.encode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LEB128.encode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LEB128.encoded_size]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=LEB128.encoded_size]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LEB128.encoded_size]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LEB128.decode_one]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=LEB128.decode_one]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LEB128.decode_one]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LEB128.decode_u32]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=LEB128.decode_u32]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LEB128.decode_u32]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LEB128.encode_decode__3000x4000]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=LEB128.encode_decode__3000x4000]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LEB128.encode_decode__3000x4000]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LEB128.encode_decode]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=LEB128.encode_decode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LEB128.encode_decode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LEB128.decode_many]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=LEB128.decode_many]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LEB128.decode_many]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LEB128.decode_many__truncated]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=LEB128.decode_many__truncated]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LEB128.decode_many__truncated]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[bit_packed.row_stride]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=bit_packed.row_stride]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[bit_packed.row_stride]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[bit_packed.visit_runs]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=bit_packed.visit_runs]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[bit_packed.visit_runs]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[bit_packed.visit_runs__all_zeros]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=bit_packed.visit_runs__all_zeros]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[bit_packed.visit_runs__all_zeros]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[bit_packed.writer]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=bit_packed.writer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[bit_packed.writer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[bit_packed.check]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=bit_packed.check]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[bit_packed.check]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[bit_stream.write_read]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=bit_stream.write_read]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[bit_stream.write_read]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[bit_stream.writer__buffer_too_small]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=bit_stream.writer__buffer_too_small]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[bit_stream.writer__buffer_too_small]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImageFileTest.save_load]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImageFileTest.save_load]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImageFileTest.save_load]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImageFileTest.load__corrupt]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImageFileTest.load__corrupt]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImageFileTest.load__corrupt]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImageFileTest.load__truncated]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImageFileTest.load__truncated]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImageFileTest.load__truncated]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImageFileTest.load__bad_magic]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImageFileTest.load__bad_magic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImageFileTest.load__bad_magic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImageFileTest.load__missing]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImageFileTest.load__missing]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImageFileTest.load__missing]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImageFileTest.save_load__row_index]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImageFileTest.save_load__row_index]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImageFileTest.save_load__row_index]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImageFileTest.load__corrupt_row_index]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImageFileTest.load__corrupt_row_index]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImageFileTest.load__corrupt_row_index]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImageFile.save__write_error]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImageFile.save__write_error]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImageFile.save__write_error]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.ctor_all_zeros]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.ctor_all_zeros]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.ctor_all_zeros]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.iterate_all_zeros]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.iterate_all_zeros]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.iterate_all_zeros]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.all_zeros_large]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.all_zeros_large]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.all_zeros_large]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.test_1]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.test_1]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.test_1]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.from_sparse_image]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.from_sparse_image]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.from_sparse_image]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.make_sparse_image]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.make_sparse_image]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.make_sparse_image]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.make_sparse_image__expression]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.make_sparse_image__expression]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.make_sparse_image__expression]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.stats]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.stats]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.stats]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.runs]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.runs]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.runs]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.runs__random]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.runs__random]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.runs__random]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.runs__padded]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.runs__padded]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.runs__padded]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.runs__empty]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.runs__empty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.runs__empty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.from_sparse_image__overwrites]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.from_sparse_image__overwrites]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.from_sparse_image__overwrites]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.from_sparse_image__roi]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.from_sparse_image__roi]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.from_sparse_image__roi]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.row_begin_at]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.row_begin_at]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.row_begin_at]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.at__lazy_row_index]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.at__lazy_row_index]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.at__lazy_row_index]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.copy__outlives_source]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.copy__outlives_source]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.copy__outlives_source]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.correlate]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.correlate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.correlate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.correlate__upper_left_corner]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.correlate__upper_left_corner]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.correlate__upper_left_corner]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.correlate__lower_right_corner]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.correlate__lower_right_corner]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.correlate__lower_right_corner]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.classify_kernel]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.classify_kernel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.classify_kernel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.correlate__matches_reference]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.correlate__matches_reference]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.correlate__matches_reference]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.correlate__nearly_separable_kernel]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.correlate__nearly_separable_kernel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.correlate__nearly_separable_kernel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.correlate__separable_row_passes]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.correlate__separable_row_passes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.correlate__separable_row_passes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.correlate__integer_kernels]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.correlate__integer_kernels]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.correlate__integer_kernels]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.correlate__kernel_larger_than_image]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.correlate__kernel_larger_than_image]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.correlate__kernel_larger_than_image]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.correlate_rows]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.correlate_rows]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.correlate_rows]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.correlate__thread_pool]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.correlate__thread_pool]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.correlate__thread_pool]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.CWiseBinaryOp]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.CWiseBinaryOp]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.CWiseBinaryOp]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.CWiseOp]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.CWiseOp]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.CWiseOp]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.combine]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.combine]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.combine]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseImage.combine__empty_and_full]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=SparseImage.combine__empty_and_full]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SparseImage.combine__empty_and_full]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPool.parallel_for]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=ThreadPool.parallel_for]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPool.parallel_for]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPool.parallel_for__nested]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=ThreadPool.parallel_for__nested]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPool.parallel_for__nested]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPool.parallel_for__exception]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=ThreadPool.parallel_for__exception]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPool.parallel_for__exception]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MapStorage.ctor]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=MapStorage.ctor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MapStorage.ctor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BinaryOp.eval_scalar_operand]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=BinaryOp.eval_scalar_operand]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BinaryOp.eval_scalar_operand]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BinaryOp.eval_scalar_addition]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=BinaryOp.eval_scalar_addition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BinaryOp.eval_scalar_addition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BinaryOp.eval_scalar_subtraction]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=BinaryOp.eval_scalar_subtraction]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BinaryOp.eval_scalar_subtraction]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BinaryOp.eval_nested_operation]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=BinaryOp.eval_nested_operation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BinaryOp.eval_nested_operation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IteratedBinaryOp.Summation]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=IteratedBinaryOp.Summation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IteratedBinaryOp.Summation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IteratedBinaryOp.Product]=]  /root/repo/_san_build/test/unit/run_unit_test [==[--gtest_filter=IteratedBinaryOp.Product]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IteratedBinaryOp.Product]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_san_build/test/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  run_unit_test_TESTS MaskLogTest.append_read MaskLogTest.reopen_append MaskLogTest.frame_outlives_refresh MaskLogTest.concurrent_readers MaskLogTest.open__missing Morphology.dilate Morphology.erode__border_is_neutral Morphology.opening_and_closing_bound_the_mask Morphology.matches_reference Morphology.encodes_like_sparse_image Morphology.structuring_element_sizes rle_mmr.encode_decode__all_zeros rle_mmr.encode_decode__blobs rle_mmr.encode_decode__noise rle_mmr.encode_decode__narrow rle_mmr.max_encoded_size rle_mmr.encode__bad_width rle_mmr.decode__truncated RowIndex.seek_points RowIndex.stride RowIndex.padding RowIndex.copy_move rle_multi.encode__u8 rle_multi.encode_decode__u8 rle_multi.encode_decode__u16 rle_multi.max_encoded_size rle_multi.decode__value_out_of_range rle.encode rle.encode_decode rle.encode_decode_sparse rle.encode_decode_sparse_small rle.encode_decode__bit_packed rle_v2.encode__all_zeros rle_v2.encode__v_u8_10 rle_v2.encode__a_u8_2x3 rle_v2.encode__runs_across_simd_blocks rle_v2.encode__long_runs rle_v2.encoded_size rle_v2.max_encoded_size rle_v2.encode_decode rle_v2.encode_decode_sparse rle_v2.encode_decode_sparse_small rle_v2.Encoder__matches_one_shot rle_v2.Decoder__matches_one_shot rle_v2.encode_decode__bit_packed rle_v2.stats rle_v2.stats__random rle_v2.append_run rle_v2_batch.encode_decode rle_v2_batch.encode_decode__thread_pool rle_v2_batch.encode__arena_too_small rle_v2_batch.bad_offsets rle_v2_framed.encode_decode rle_v2_framed.encode_decode__thread_pool rle_v2_framed.band_start_values rle_v2_framed.decode__buffer_too_small rle_v3.encode__all_zeros rle_v3.encode__v_u8_10 rle_v3.encode__multi_byte_lengths rle_v3.encode_decode rle_v3.max_encoded_size rle_v3.decode__truncated rle_v4.encode_decode__all_zeros rle_v4.encode_decode rle_v4.encode_decode__long_runs rle_v4.max_encoded_size rle_v4.decode__truncated LEB128.encode LEB128.encoded_size LEB128.decode_one LEB128.decode_u32 LEB128.encode_decode__3000x4000 LEB128.encode_decode LEB128.decode_many LEB128.decode_many__truncated bit_packed.row_stride bit_packed.visit_runs bit_packed.visit_runs__all_zeros bit_packed.writer bit_packed.check bit_stream.write_read bit_stream.writer__buffer_too_small SparseImageFileTest.save_load SparseImageFileTest.load__corrupt SparseImageFileTest.load__truncated SparseImageFileTest.load__bad_magic SparseImageFileTest.load__missing SparseImageFileTest.save_load__row_index SparseImageFileTest.load__corrupt_row_index SparseImageFile.save__write_error SparseImage.ctor_all_zeros SparseImage.iterate_all_zeros SparseImage.all_zeros_large SparseImage.test_1 SparseImage.from_sparse_image SparseImage.make_sparse_image SparseImage.make_sparse_image__expression SparseImage.stats SparseImage.runs SparseImage.runs__random SparseImage.runs__padded SparseImage.runs__empty SparseImage.from_sparse_image__overwrites SparseImage.from_sparse_image__roi SparseImage.row_begin_at SparseImage.at__lazy_row_index SparseImage.copy__outlives_source SparseImage.correlate SparseImage.correlate__upper_left_corner SparseImage.correlate__lower_right_corner SparseImage.classify_kernel SparseImage.correlate__matches_reference SparseImage.correlate__nearly_separable_kernel SparseImage.correlate__separable_row_passes SparseImage.correlate__integer_kernels SparseImage.correlate__kernel_larger_than_image SparseImage.correlate_rows SparseImage.correlate__thread_pool SparseImage.CWiseBinaryOp SparseImage.CWiseOp SparseImage.combine SparseImage.combine__empty_and_full ThreadPool.parallel_for ThreadPool.parallel_for__nested ThreadPool.parallel_for__exception MapStorage.ctor BinaryOp.eval_scalar_operand BinaryOp.eval_scalar_addition BinaryOp.eval_scalar_subtraction BinaryOp.eval_nested_operation IteratedBinaryOp.Summation IteratedBinaryOp.Product)
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+
+namespace codec::bit_packed
+{
+
+// Number of 64-bit words needed to store one row of width pixels.
+constexpr size_t row_stride(size_t width)
+{
+    return (width + 63) / 64;
+}
+
+// A bit-packed mask with one bit per pixel. Pixel (u, v) is bit u % 64 of
+// words[v * stride + u / 64], least significant bit first. Each row starts on a
+// word boundary; padding bits past width are ignored when reading and left
+// untouched when writing.
+template <typename Word>
+struct BasicMask
+{
+    std::span<Word> words;
+    size_t width;
+    size_t height;
+    size_t stride;
+
+    size_t size() const { return width * height; }
+
+    void check() const
+    {
+        if (stride < row_stride(width))
+        {
+            throw std::runtime_error("bit-packed row stride too small");
+        }
+        if (height && words.size() < stride * (height - 1) + row_stride(width))
+        {
+            throw std::runtime_error("bit-packed buffer too small");
+        }
+    }
+};
+
+using Mask = BasicMask<uint64_t>;
+using ConstMask = BasicMask<const uint64_t>;
+
+// Calls emit(run_length) for every run of equal pixels in row-major order,
+// starting with a (possibly empty) run of zeros and ending with the last run.
+// Transitions are found a word at a time with count-trailing-zeros.
+template <typename Emit>
+void visit_runs(ConstMask mask, Emit &&emit)
+{
+    mask.check();
+
+    bool cur_val = false;
+    size_t run_length = 0;
+
+    for (size_t v = 0; v < mask.height; v++)
+    {
+        const uint64_t *row = mask.words.data() + v * mask.stride;
+        size_t u = 0;
+        while (u < mask.width)
+        {
+            const size_t word_i = u / 64;
+            const size_t word_end = std::min(mask.width, (word_i + 1) * 64);
+
+            // Bits that differ from the current value, at or after u.
+            const uint64_t diff = (row[word_i] ^ (cur_val ? ~uint64_t(0) : 0)) & (~uint64_t(0) << (u % 64));
+            if (diff)
+            {
+                const size_t transition = word_i * 64 + std::countr_zero(diff);
+                if (transition < word_end)
+                {
+                    emit(run_length + transition - u);
+                    run_length = 0;
+                    cur_val = !cur_val;
+                    u = transition;
+                    continue;
+                }
+            }
+
+            run_length += word_end - u;
+            u = word_end;
+        } // end while
+    } // end for v
+
+    emit(run_length);
+}
+
+// Sets bits [begin, end) of a row to value.
+inline void fill_row(uint64_t *row, size_t begin, size_t end, bool value)
+{
+    if (begin >= end)
+    {
+        return;
+    }
+
+    const size_t first_word = begin / 64;
+    const size_t last_word = (end - 1) / 64;
+    const uint64_t first_mask = ~uint64_t(0) << (begin % 64);
+    const uint64_t last_mask = ~uint64_t(0) >> (63 - (end - 1) % 64);
+
+    auto apply = [value](uint64_t &word, uint64_t bits) { word = value ? (word | bits) : (word & ~bits); };
+
+    if (first_word == last_word)
+    {
+        apply(row[first_word], first_mask & last_mask);
+        return;
+    }
+
+    apply(row[first_word], first_mask);
+    std::memset(row + first_word + 1, value ? 0xff : 0x00, (last_word - first_word - 1) * sizeof(uint64_t));
+    apply(row[last_word], last_mask);
+}
+
+// Writes runs of pixels to a bit-packed mask in row-major order.
+class Writer
+{
+  public:
+    explicit Writer(Mask mask) : mask_(mask), u_(), v_()
+    {
+        mask_.check();
+    }
+
+    size_t remaining() const
+    {
+        return mask_.size() - (v_ * mask_.width + u_);
+    }
+
+    void write(size_t count, bool value)
+    {
+        if (count > remaining())
+        {
+            throw std::runtime_error("data buffer too small");
+        }
+
+        while (count)
+        {
+            const size_t n = std::min(count, mask_.width - u_);
+            fill_row(mask_.words.data() + v_ * mask_.stride, u_, u_ + n, value);
+            count -= n;
+            u_ += n;
+            if (mask_.width == u_)
+            {
+                u_ = 0;
+                ++v_;
+            }
+        }
+    }
+
+  private:
+    Mask mask_;
+    size_t u_;
+    size_t v_;
+};
+
+}
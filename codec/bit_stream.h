@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+
+// Least-significant-bit-first bit streams.
+namespace codec::bit_stream
+{
+
+class Writer
+{
+  public:
+    explicit Writer(std::span<uint8_t> buff) :
+        buff_(buff),
+        it_(buff.begin()),
+        bit_buf_(),
+        bit_count_()
+    {
+    }
+
+    // Appends the low n_bits (at most 32) bits of bits.
+    void write(uint64_t bits, unsigned n_bits)
+    {
+        bit_buf_ |= (bits & ((uint64_t(1) << n_bits) - 1)) << bit_count_;
+        bit_count_ += n_bits;
+        while (bit_count_ >= 8)
+        {
+            put(static_cast<uint8_t>(bit_buf_));
+            bit_buf_ >>= 8;
+            bit_count_ -= 8;
+        }
+    }
+
+    // Flushes the last partial byte, padded with zeros, and returns the written
+    // part of the buffer.
+    std::span<uint8_t> finish()
+    {
+        if (bit_count_)
+        {
+            put(static_cast<uint8_t>(bit_buf_));
+            bit_buf_ = 0;
+            bit_count_ = 0;
+        }
+        return std::span(buff_.begin(), it_);
+    }
+
+  private:
+    void put(uint8_t byte)
+    {
+        if (buff_.end() == it_)
+        {
+            throw std::runtime_error("rle_buff buffer too small");
+        }
+        *it_++ = byte;
+    }
+
+    std::span<uint8_t> buff_;
+    std::span<uint8_t>::iterator it_;
+    uint64_t bit_buf_;
+    unsigned bit_count_;
+};
+
+class Reader
+{
+  public:
+    explicit Reader(std::span<const uint8_t> buff) :
+        it_(buff.data()),
+        end_(buff.data() + buff.size()),
+        bit_buf_(),
+        bit_count_(),
+        bits_left_(8 * buff.size())
+    {
+    }
+
+    // Returns the next n_bits (at most 32) bits without consuming them. Bits past
+    // the end of the buffer read as zero.
+    uint32_t peek(unsigned n_bits)
+    {
+        refill();
+        return static_cast<uint32_t>(bit_buf_ & ((uint64_t(1) << n_bits) - 1));
+    }
+
+    void consume(unsigned n_bits)
+    {
+        if (n_bits > bits_left_)
+        {
+            throw std::runtime_error("unexpectedly reached end of buffer");
+        }
+        if (n_bits > bit_count_)
+        {
+            refill();
+        }
+        bits_left_ -= n_bits;
+        bit_buf_ >>= n_bits;
+        bit_count_ -= n_bits;
+    }
+
+    uint32_t read(unsigned n_bits)
+    {
+        const uint32_t bits = peek(n_bits);
+        consume(n_bits);
+        return bits;
+    }
+
+    size_t bits_left() const { return bits_left_; }
+
+  private:
+    void refill()
+    {
+        while (bit_count_ <= 56 && it_ < end_)
+        {
+            bit_buf_ |= static_cast<uint64_t>(*it_++) << bit_count_;
+            bit_count_ += 8;
+        }
+    }
+
+    const uint8_t *it_;
+    const uint8_t *end_;
+    uint64_t bit_buf_;
+    unsigned bit_count_;
+    size_t bits_left_;
+};
+
+}
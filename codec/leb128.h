@@ -1,11 +1,17 @@
 #pragma once
 
+#include <bit>
 #include <concepts>
+#include <cstddef>
 #include <cstdint>
 #include <stdexcept>
 #include <span>
 #include <tuple>
 
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
 namespace codec::leb128
 {
 
@@ -30,6 +36,14 @@ std::span<uint8_t> encode(T val, std::span<uint8_t> buff)
     return std::span(buff.begin(), it);
 }
 
+// Number of bytes encode(val, ...) writes.
+template <typename T>
+requires std::unsigned_integral<T>
+constexpr size_t encoded_size(T val)
+{
+    return (std::bit_width(static_cast<T>(val | T(1))) + 6) / 7;
+}
+
 template <typename T>
 requires std::integral<T>
 std::tuple<T, std::span<const uint8_t>> decode_one(std::span<const uint8_t> buff)
@@ -46,7 +60,7 @@ std::tuple<T, std::span<const uint8_t>> decode_one(std::span<const uint8_t> buff
         }
         const uint8_t code = *it++;
         more_bytes = 0x80 & code;
-        val += (0x7f & code) << val_shift;
+        val += static_cast<T>(0x7f & code) << val_shift;
         val_shift += 7;
     }
     while (more_bytes);
@@ -54,4 +68,91 @@ std::tuple<T, std::span<const uint8_t>> decode_one(std::span<const uint8_t> buff
     return {val, std::span<const uint8_t>(buff.begin(), it)};
 }
 
-}
\ No newline at end of file
+// Decodes a uint32_t and advances it past the encoded bytes. Unlike decode_one,
+// this avoids building a tuple and a span per value, and single-byte values
+// (the common case for run lengths) take a single branch.
+inline uint32_t decode_u32(const uint8_t *&it, const uint8_t *end)
+{
+    if (it >= end)
+    {
+        throw std::runtime_error("unexpectedly reached end of buffer");
+    }
+
+    uint32_t code = *it++;
+    if (!(0x80 & code))
+    {
+        return code;
+    }
+
+    uint32_t val = 0x7f & code;
+    for (uint32_t val_shift = 7; val_shift < 32; val_shift += 7)
+    {
+        if (it >= end)
+        {
+            throw std::runtime_error("unexpectedly reached end of buffer");
+        }
+        code = *it++;
+        if (28 == val_shift && (0x70 & code))
+        {
+            throw std::runtime_error("value does not fit in uint32_t");
+        }
+        val |= (0x7f & code) << val_shift;
+        if (!(0x80 & code))
+        {
+            return val;
+        }
+    }
+
+    throw std::runtime_error("value does not fit in uint32_t");
+}
+
+// Decodes consecutive uint32_t values from buff into out until either one is
+// exhausted. Returns the number of values decoded and the bytes they used.
+//
+// Sixteen input bytes are examined at a time: the movemask of their
+// continuation bits tells how many leading values are single bytes, and those
+// are widened and stored with SIMD. Multi-byte values fall back to decode_u32.
+// Entries of out past the returned count may be overwritten.
+inline std::tuple<size_t, std::span<const uint8_t>> decode_many(std::span<const uint8_t> buff, std::span<uint32_t> out)
+{
+    const uint8_t *it = buff.data();
+    const uint8_t *const end = buff.data() + buff.size();
+    uint32_t *out_it = out.data();
+    uint32_t *const out_end = out.data() + out.size();
+
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    while (end - it >= 16 && out_end - out_it >= 16)
+    {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+        const uint32_t more_bytes = _mm_movemask_epi8(chunk);
+        const size_t n_single = more_bytes ? std::countr_zero(more_bytes) : 16;
+
+        if (n_single)
+        {
+            const __m128i lo = _mm_unpacklo_epi8(chunk, zero);
+            const __m128i hi = _mm_unpackhi_epi8(chunk, zero);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out_it + 0), _mm_unpacklo_epi16(lo, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out_it + 4), _mm_unpackhi_epi16(lo, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out_it + 8), _mm_unpacklo_epi16(hi, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out_it + 12), _mm_unpackhi_epi16(hi, zero));
+            it += n_single;
+            out_it += n_single;
+        }
+
+        if (more_bytes)
+        {
+            *out_it++ = decode_u32(it, end);
+        }
+    }
+#endif
+
+    while (it < end && out_it < out_end)
+    {
+        *out_it++ = decode_u32(it, end);
+    }
+
+    return {out_it - out.data(), std::span<const uint8_t>(buff.data(), it)};
+}
+
+}
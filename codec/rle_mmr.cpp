@@ -0,0 +1,299 @@
+#include "codec/rle_mmr.h"
+#include "codec/bit_stream.h"
+#include "codec/run_scan.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+namespace rle::mmr {
+
+enum class Mode : uint8_t
+{
+    INVALID,
+    PASS,
+    HORIZONTAL,
+    VERTICAL,
+};
+
+struct ModeCode
+{
+    Mode mode;
+    int8_t offset;
+    uint8_t code;
+    uint8_t length;
+};
+
+// T.4 two-dimensional mode codes, most significant bit first.
+static constexpr std::array<ModeCode, 9> mode_codes{{
+    {Mode::VERTICAL, 0, 0b1, 1},
+    {Mode::VERTICAL, 1, 0b011, 3},
+    {Mode::VERTICAL, -1, 0b010, 3},
+    {Mode::HORIZONTAL, 0, 0b001, 3},
+    {Mode::PASS, 0, 0b0001, 4},
+    {Mode::VERTICAL, 2, 0b000011, 6},
+    {Mode::VERTICAL, -2, 0b000010, 6},
+    {Mode::VERTICAL, 3, 0b0000011, 7},
+    {Mode::VERTICAL, -3, 0b0000010, 7},
+}};
+
+static constexpr unsigned max_mode_code_length = 7;
+
+// The bit stream is least significant bit first, so codes are written reversed.
+static constexpr uint32_t reverse_bits(uint32_t code, unsigned length)
+{
+    uint32_t reversed = 0;
+    for (unsigned bit = 0; bit < length; bit++)
+    {
+        reversed |= ((code >> bit) & 1) << (length - 1 - bit);
+    }
+    return reversed;
+}
+
+static constexpr std::array<ModeCode, 1 << max_mode_code_length> make_mode_table()
+{
+    std::array<ModeCode, 1 << max_mode_code_length> table{};
+    for (const ModeCode &mode_code : mode_codes)
+    {
+        const uint32_t reversed = reverse_bits(mode_code.code, mode_code.length);
+        for (uint32_t fill = 0; fill < (1u << (max_mode_code_length - mode_code.length)); fill++)
+        {
+            table[reversed | (fill << mode_code.length)] = mode_code;
+        }
+    }
+    return table;
+}
+
+static constexpr std::array<ModeCode, 1 << max_mode_code_length> mode_table = make_mode_table();
+
+static void write_mode(codec::bit_stream::Writer &writer, Mode mode, int offset = 0)
+{
+    for (const ModeCode &mode_code : mode_codes)
+    {
+        if (mode_code.mode == mode && mode_code.offset == offset)
+        {
+            writer.write(reverse_bits(mode_code.code, mode_code.length), mode_code.length);
+            return;
+        }
+    }
+}
+
+static ModeCode read_mode(codec::bit_stream::Reader &reader)
+{
+    const ModeCode mode_code = mode_table[reader.peek(max_mode_code_length)];
+    if (Mode::INVALID == mode_code.mode)
+    {
+        throw std::runtime_error("invalid mode code");
+    }
+    reader.consume(mode_code.length);
+    return mode_code;
+}
+
+// Exp-Golomb code of run_length + 1: as many zeros as the value has bits after
+// its leading one, the leading one, then those bits.
+static void write_run(codec::bit_stream::Writer &writer, uint32_t run_length)
+{
+    const uint32_t val = run_length + 1;
+    const unsigned n_bits = std::bit_width(val) - 1;
+    writer.write(0, n_bits);
+    writer.write(1, 1);
+    writer.write(val, n_bits);
+}
+
+static uint32_t read_run(codec::bit_stream::Reader &reader)
+{
+    const uint32_t peeked = reader.peek(32);
+    const unsigned n_bits = std::countr_zero(peeked);
+    if (n_bits >= 32)
+    {
+        throw std::runtime_error("invalid run length");
+    }
+    reader.consume(n_bits + 1);
+    return ((1u << n_bits) | reader.read(n_bits)) - 1;
+}
+
+// Positions in row where the colour changes, starting from white, followed by
+// three sentinels at width so that b1 and b2 always exist.
+static void find_changes(const uint8_t *row, size_t width, std::vector<ptrdiff_t> &changes)
+{
+    changes.clear();
+    const uint8_t *it = row;
+    const uint8_t *const end = row + width;
+    uint8_t color = 0;
+    while (true)
+    {
+        it = codec::run_scan::find_mismatch(it, end, color);
+        if (end == it)
+        {
+            break;
+        }
+        changes.push_back(it - row);
+        color = !color;
+    }
+    changes.insert(changes.end(), 3, static_cast<ptrdiff_t>(width));
+}
+
+// Finds b1, the first change on the reference row right of a0 whose colour is
+// the opposite of color, and b2, the change after it. Changes alternate
+// between black (even indices) and white (odd indices). ref_i only moves
+// forward as a0 does.
+static void find_b1_b2(const std::vector<ptrdiff_t> &ref_changes, size_t &ref_i, ptrdiff_t a0, bool color, ptrdiff_t &b1, ptrdiff_t &b2)
+{
+    while (ref_changes[ref_i] <= a0 && ref_i + 3 < ref_changes.size())
+    {
+        ++ref_i;
+    }
+    const size_t b1_i = ref_i + ((ref_i % 2 == 0) == color ? 1 : 0);
+    b1 = ref_changes[b1_i];
+    b2 = ref_changes[b1_i + 1];
+}
+
+static void check_geometry(size_t n_pixels, size_t width)
+{
+    if (0 == width || n_pixels % width)
+    {
+        throw std::runtime_error("image size is not a multiple of the width");
+    }
+}
+
+size_t max_encoded_size(size_t n_pixels, size_t width)
+{
+    check_geometry(n_pixels, width);
+
+    // Every coding step covers at least one pixel with at most 7 bits, except
+    // for one step per row that can start with a change at the first pixel.
+    return (7 * (n_pixels + n_pixels / width) + 7) / 8;
+}
+
+std::span<uint8_t> encode(std::span<const uint8_t> data, size_t width, std::span<uint8_t> rle_buff)
+{
+    check_geometry(data.size(), width);
+
+    codec::bit_stream::Writer writer(rle_buff);
+    const ptrdiff_t w = width;
+
+    // The row above the first row is white.
+    std::vector<ptrdiff_t> ref_changes(3, w);
+    std::vector<ptrdiff_t> cur_changes;
+
+    for (size_t row_begin = 0; row_begin < data.size(); row_begin += width)
+    {
+        find_changes(data.data() + row_begin, width, cur_changes);
+
+        ptrdiff_t a0 = -1;
+        bool color = false;
+        size_t ref_i = 0;
+        size_t cur_i = 0;
+
+        while (a0 < w)
+        {
+            while (cur_changes[cur_i] <= a0) ++cur_i;
+            const ptrdiff_t a1 = cur_changes[cur_i];
+
+            ptrdiff_t b1, b2;
+            find_b1_b2(ref_changes, ref_i, a0, color, b1, b2);
+
+            if (b2 < a1)
+            {
+                write_mode(writer, Mode::PASS);
+                a0 = b2;
+            }
+            else if (std::abs(a1 - b1) <= 3)
+            {
+                write_mode(writer, Mode::VERTICAL, static_cast<int>(a1 - b1));
+                a0 = a1;
+                color = !color;
+            }
+            else
+            {
+                const ptrdiff_t a2 = cur_changes[std::min(cur_i + 1, cur_changes.size() - 1)];
+                write_mode(writer, Mode::HORIZONTAL);
+                write_run(writer, static_cast<uint32_t>(a1 - std::max<ptrdiff_t>(a0, 0)));
+                write_run(writer, static_cast<uint32_t>(a2 - a1));
+                a0 = a2;
+            }
+        } // end while
+
+        std::swap(ref_changes, cur_changes);
+    } // end for row_begin
+
+    return writer.finish();
+}
+
+std::span<uint8_t> decode(std::span<const uint8_t> rle, size_t width, std::span<uint8_t> data_buff)
+{
+    check_geometry(data_buff.size(), width);
+
+    codec::bit_stream::Reader reader(rle);
+    const ptrdiff_t w = width;
+
+    std::vector<ptrdiff_t> ref_changes(3, w);
+
+    for (size_t row_begin = 0; row_begin < data_buff.size(); row_begin += width)
+    {
+        uint8_t *row = data_buff.data() + row_begin;
+
+        ptrdiff_t a0 = -1;
+        bool color = false;
+        size_t ref_i = 0;
+
+        auto fill = [&](ptrdiff_t begin, ptrdiff_t end, bool val) {
+            if (begin > end || end > w)
+            {
+                throw std::runtime_error("corrupt stream");
+            }
+            std::memset(row + begin, val, end - begin);
+        };
+
+        while (a0 < w)
+        {
+            const ptrdiff_t start = std::max<ptrdiff_t>(a0, 0);
+
+            ptrdiff_t b1, b2;
+            find_b1_b2(ref_changes, ref_i, a0, color, b1, b2);
+
+            const ModeCode mode_code = read_mode(reader);
+            switch (mode_code.mode)
+            {
+            case Mode::PASS:
+                fill(start, b2, color);
+                a0 = b2;
+                break;
+
+            case Mode::VERTICAL:
+            {
+                const ptrdiff_t a1 = b1 + mode_code.offset;
+                if (a1 <= a0)
+                {
+                    throw std::runtime_error("corrupt stream");
+                }
+                fill(start, a1, color);
+                a0 = a1;
+                color = !color;
+                break;
+            }
+
+            case Mode::HORIZONTAL:
+            {
+                const ptrdiff_t a1 = start + read_run(reader);
+                const ptrdiff_t a2 = a1 + read_run(reader);
+                fill(start, a1, color);
+                fill(a1, a2, !color);
+                a0 = a2;
+                break;
+            }
+
+            default:
+                throw std::runtime_error("invalid mode code");
+            }
+        } // end while
+
+        find_changes(row, width, ref_changes);
+    } // end for row_begin
+
+    return data_buff;
+}
+
+}
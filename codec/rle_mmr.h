@@ -0,0 +1,21 @@
+#pragma once
+
+#include <span>
+#include <cstddef>
+#include <cstdint>
+
+// Two-dimensional coding of binary masks in the spirit of CCITT Group 4 (MMR).
+// Each row's transitions are coded relative to the transitions of the row
+// above, so blob-like masks whose edges move little from row to row cost a
+// bit or a few bits per edge. The mode codes follow T.4; horizontal-mode runs
+// are Exp-Golomb coded instead of using the fax run-length tables.
+namespace rle::mmr {
+
+std::span<uint8_t> encode(std::span<const uint8_t> data, size_t width, std::span<uint8_t> rle_buff);
+std::span<uint8_t> decode(std::span<const uint8_t> rle, size_t width, std::span<uint8_t> data_buff);
+
+// Upper bound on the encoded size of any image of n_pixels pixels in rows of
+// width pixels.
+size_t max_encoded_size(size_t n_pixels, size_t width);
+
+}
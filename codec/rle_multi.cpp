@@ -0,0 +1,76 @@
+#include "codec/rle_multi.h"
+#include "codec/leb128.h"
+#include "codec/run_scan.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace rle::multi {
+
+template <typename T>
+static std::span<uint8_t> encode_impl(std::span<const T> data, std::span<uint8_t> rle_buff)
+{
+    auto rle_it = rle_buff.begin();
+    const T* it = data.data();
+    const T* const end = data.data() + data.size();
+
+    while (end != it)
+    {
+        const T val = *it;
+        const T* run_end = codec::run_scan::find_mismatch(it + 1, end, val);
+
+        rle_it = codec::leb128::encode(val, std::span(rle_it, rle_buff.end())).end();
+        rle_it = codec::leb128::encode(static_cast<uint32_t>(run_end - it), std::span(rle_it, rle_buff.end())).end();
+        it = run_end;
+    } // end while
+
+    return std::span(rle_buff.begin(), rle_it);
+}
+
+template <typename T>
+static std::span<T> decode_impl(std::span<const uint8_t> rle_buff, std::span<T> data_buff)
+{
+    T* data_it = data_buff.data();
+    T* const data_end = data_buff.data() + data_buff.size();
+    const uint8_t* rle_it = rle_buff.data();
+    const uint8_t* const rle_end = rle_buff.data() + rle_buff.size();
+
+    while (rle_end > rle_it)
+    {
+        const uint32_t val = codec::leb128::decode_u32(rle_it, rle_end);
+        const uint32_t run_length = codec::leb128::decode_u32(rle_it, rle_end);
+
+        if (val > std::numeric_limits<T>::max())
+        {
+            throw std::runtime_error("value out of range for the pixel type");
+        }
+        if (static_cast<size_t>(data_end - data_it) < run_length)
+        {
+            throw std::runtime_error("data buffer too small");
+        }
+        data_it = std::fill_n(data_it, run_length, static_cast<T>(val));
+    } // end while
+
+    return std::span(data_buff.data(), data_it);
+}
+
+std::span<uint8_t> encode(std::span<const uint8_t> data, std::span<uint8_t> rle_buff)
+{
+    return encode_impl(data, rle_buff);
+}
+
+std::span<uint8_t> encode(std::span<const uint16_t> data, std::span<uint8_t> rle_buff)
+{
+    return encode_impl(data, rle_buff);
+}
+
+std::span<uint8_t> decode(std::span<const uint8_t> rle, std::span<uint8_t> data_buff)
+{
+    return decode_impl(rle, data_buff);
+}
+
+std::span<uint16_t> decode(std::span<const uint8_t> rle, std::span<uint16_t> data_buff)
+{
+    return decode_impl(rle, data_buff);
+}
+
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "codec/leb128.h"
+#include <span>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+// Run-length coding of label and class-ID images. Each run is stored as a
+// (value, run length) pair of LEB128 integers, so values below 128 take a
+// single byte.
+namespace rle::multi {
+
+std::span<uint8_t> encode(std::span<const uint8_t> data, std::span<uint8_t> rle_buff);
+std::span<uint8_t> encode(std::span<const uint16_t> data, std::span<uint8_t> rle_buff);
+
+// Decodes into data_buff and returns the decoded pixels. Pixels past the end
+// of the stream are left untouched.
+std::span<uint8_t> decode(std::span<const uint8_t> rle, std::span<uint8_t> data_buff);
+std::span<uint16_t> decode(std::span<const uint8_t> rle, std::span<uint16_t> data_buff);
+
+// Upper bound on the encoded size of any image of n_pixels pixels of type T:
+// every pixel starts a new run of length one.
+template <typename T>
+constexpr size_t max_encoded_size(size_t n_pixels)
+{
+    return n_pixels * (codec::leb128::encoded_size(std::numeric_limits<T>::max()) + 1);
+}
+
+}
@@ -1,4 +1,5 @@
 #include "codec/rle_v1.h"
+#include <algorithm>
 #include <stdexcept>
 #include <cassert>
 #include <vector>
@@ -29,38 +30,44 @@ static const std::vector<int> make_skip_table()
 
 static const std::vector<int> skip_table = make_skip_table();
 
-std::span<uint8_t> encode(std::span<const uint8_t> data, std::span<uint8_t> rle_buff)
+static std::span<uint8_t>::iterator encode_run(int run_length, std::span<uint8_t> rle_buff, std::span<uint8_t>::iterator rle_it)
 {
-    bool prev_val = 0;
-    int run_length = 0;
-    auto rle_it = rle_buff.begin();
-    for (const uint8_t val : data)
+    for (size_t skip_table_i = 0; skip_table_i < skip_table.size(); skip_table_i++)
     {
-        if (val != prev_val)
+        int skip_val = skip_table[skip_table_i];
+        while (run_length > skip_val)
         {
-            for (size_t skip_table_i = 0; skip_table_i < skip_table.size(); skip_table_i++)
-            {
-                int skip_val = skip_table[skip_table_i];
-                while (run_length > skip_val)
-                {
-                    if (rle_buff.end() == rle_it)
-                    {
-                        throw std::runtime_error("rle_buff buffer too small");
-                    }
-
-                    *rle_it++ = 0xff - skip_table_i;
-                    run_length -= skip_val;
-                }
-            } // end for skip_table_i
-
             if (rle_buff.end() == rle_it)
             {
                 throw std::runtime_error("rle_buff buffer too small");
             }
 
-            assert(run_length < 0xff - (skip_table.size() - 1));
+            *rle_it++ = 0xff - skip_table_i;
+            run_length -= skip_val;
+        }
+    } // end for skip_table_i
+
+    if (rle_buff.end() == rle_it)
+    {
+        throw std::runtime_error("rle_buff buffer too small");
+    }
+
+    assert(run_length < 0xff - (skip_table.size() - 1));
+
+    *rle_it++ = static_cast<uint8_t>(run_length);
+    return rle_it;
+}
 
-            *rle_it++ = static_cast<uint8_t>(run_length);
+std::span<uint8_t> encode(std::span<const uint8_t> data, std::span<uint8_t> rle_buff)
+{
+    bool prev_val = 0;
+    int run_length = 0;
+    auto rle_it = rle_buff.begin();
+    for (const uint8_t val : data)
+    {
+        if (val != prev_val)
+        {
+            rle_it = encode_run(run_length, rle_buff, rle_it);
             run_length = 0;
         } // end if
         else
@@ -72,43 +79,79 @@ std::span<uint8_t> encode(std::span<const uint8_t> data, std::span<uint8_t> rle_
     return std::span(rle_buff.begin(), rle_it);
 }
 
-std::span<uint8_t> decode(std::span<const uint8_t> rle, std::span<uint8_t> data_buff)
+std::span<uint8_t> encode(codec::bit_packed::ConstMask data, std::span<uint8_t> rle_buff)
+{
+    auto rle_it = rle_buff.begin();
+
+    // The pixel that starts a run is written by the code of the previous run, so
+    // every run after the first is stored as length - 1, and the last run is
+    // implied by the size of the output.
+    size_t run_i = 0;
+    size_t pending_run_length = 0;
+    codec::bit_packed::visit_runs(data, [&](size_t run_length) {
+        if (run_i > 0)
+        {
+            rle_it = encode_run(pending_run_length, rle_buff, rle_it);
+        }
+        pending_run_length = run_i > 0 ? run_length - 1 : run_length;
+        ++run_i;
+    });
+
+    return std::span(rle_buff.begin(), rle_it);
+}
+
+// Calls write(count, value) for each span of pixels in rle and returns the value
+// used to fill the remainder of the output.
+template <typename Write>
+static bool decode_runs(std::span<const uint8_t> rle, Write &&write)
 {
     bool cur_val = 0;
-    auto data_it = data_buff.begin();
     for (const uint8_t rle_val : rle)
     {
         const size_t skip_table_i = 0xff - rle_val;
         if (skip_table_i < skip_table.size())
         {
-            const int skip_val = skip_table[skip_table_i];
-            data_it += skip_val;
+            write(skip_table[skip_table_i], cur_val);
         }
         else
         {
-            for (size_t i = 0; i < rle_val; i++)
-            {
-                if (data_buff.end() == data_it)
-                {
-                    throw std::runtime_error("data buffer too small");
-                }
-                *data_it++ = cur_val;
-            }
+            write(rle_val, cur_val);
             cur_val = !cur_val;
-            if (data_buff.end() == data_it)
-            {
-                throw std::runtime_error("data buffer too small");
-            }
-            *data_it++ = cur_val;
+            write(1, cur_val);
         }
     } // end for
 
-    while (data_buff.end() != data_it)
-    {
-        *data_it++ = cur_val;
-    }
+    return cur_val;
+}
+
+std::span<uint8_t> decode(std::span<const uint8_t> rle, std::span<uint8_t> data_buff)
+{
+    auto data_it = data_buff.begin();
+
+    const bool cur_val = decode_runs(rle, [&](size_t count, bool val) {
+        if (static_cast<size_t>(data_buff.end() - data_it) < count)
+        {
+            throw std::runtime_error("data buffer too small");
+        }
+        data_it = std::fill_n(data_it, count, val);
+    });
+
+    std::fill(data_it, data_buff.end(), cur_val);
+
+    return data_buff;
+}
+
+codec::bit_packed::Mask decode(std::span<const uint8_t> rle, codec::bit_packed::Mask data_buff)
+{
+    codec::bit_packed::Writer writer(data_buff);
+
+    const bool cur_val = decode_runs(rle, [&](size_t count, bool val) {
+        writer.write(count, val);
+    });
+
+    writer.write(writer.remaining(), cur_val);
 
-    return std::span(data_buff.begin(), data_it);
+    return data_buff;
 }
 
 }
\ No newline at end of file
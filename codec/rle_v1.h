@@ -1,5 +1,6 @@
 #pragma once
 
+#include "codec/bit_packed.h"
 #include <span>
 #include <cstdint>
 
@@ -8,4 +9,9 @@ namespace rle::v1 {
 std::span<uint8_t> encode(std::span<const uint8_t> data, std::span<uint8_t> rle_buff);
 std::span<uint8_t> decode(std::span<const uint8_t> rle, std::span<uint8_t> data_buff);
 
+// Bit-packed (1 bit per pixel) variants. They produce and consume the same
+// encoded stream as the byte-per-pixel versions.
+std::span<uint8_t> encode(codec::bit_packed::ConstMask data, std::span<uint8_t> rle_buff);
+codec::bit_packed::Mask decode(std::span<const uint8_t> rle, codec::bit_packed::Mask data_buff);
+
 }
\ No newline at end of file
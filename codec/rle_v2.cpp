@@ -1,76 +1,227 @@
 #include "codec/rle_v2.h"
+#include "codec/bit_packed.h"
 #include "codec/leb128.h"
+#include "codec/run_scan.h"
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <stdexcept>
 #include <cassert>
+#include <cstring>
 #include <vector>
 #include <cmath>
 #include <iostream>
 
 namespace rle::v2 {
 
+static std::span<uint8_t>::iterator encode_run(uint32_t run_length, std::span<uint8_t> rle_buff, std::span<uint8_t>::iterator rle_it)
+{
+    if (rle_buff.end() == rle_it)
+    {
+        throw std::runtime_error("rle_buff buffer too small");
+    }
+
+    std::span<uint8_t> encoded = codec::leb128::encode(run_length, std::span(rle_it, rle_buff.end()));
+    return encoded.end();
+}
+
 std::span<uint8_t> encode(std::span<const uint8_t> data, std::span<uint8_t> rle_buff)
 {
     bool prev_val = false;
     uint32_t run_length = 0;
     auto rle_it = rle_buff.begin();
-    for (const uint8_t val : data)
+
+    codec::run_scan::scan_runs(data, prev_val, run_length, [&](uint32_t run_length) {
+        rle_it = encode_run(run_length, rle_buff, rle_it);
+    });
+    rle_it = encode_run(run_length, rle_buff, rle_it);
+
+    return std::span(rle_buff.begin(), rle_it);
+}
+
+Encoder::Encoder(bool initial_value) :
+    prev_val_(initial_value),
+    run_length_(0)
+{
+}
+
+std::span<uint8_t> Encoder::push(std::span<const uint8_t> data, std::span<uint8_t> rle_buff)
+{
+    auto rle_it = rle_buff.begin();
+
+    codec::run_scan::scan_runs(data, prev_val_, run_length_, [&](uint32_t run_length) {
+        rle_it = encode_run(run_length, rle_buff, rle_it);
+    });
+
+    return std::span(rle_buff.begin(), rle_it);
+}
+
+std::span<uint8_t> Encoder::finish(std::span<uint8_t> rle_buff)
+{
+    auto rle_it = encode_run(run_length_, rle_buff, rle_buff.begin());
+    run_length_ = 0;
+
+    return std::span(rle_buff.begin(), rle_it);
+}
+
+size_t encoded_size(std::span<const uint8_t> data, bool initial_value)
+{
+    bool prev_val = initial_value;
+    uint32_t run_length = 0;
+    size_t size = 0;
+
+    codec::run_scan::scan_runs(data, prev_val, run_length, [&](uint32_t run_length) {
+        size += codec::leb128::encoded_size(run_length);
+    });
+    size += codec::leb128::encoded_size(run_length);
+
+    return size;
+}
+
+Stats& Stats::operator+=(const Stats &other)
+{
+    n_runs += other.n_runs;
+    n_one_runs += other.n_one_runs;
+    n_pixels += other.n_pixels;
+    n_ones += other.n_ones;
+    encoded_size += other.encoded_size;
+    for (size_t i = 0; i < run_length_histogram.size(); i++)
     {
-        if (val != prev_val)
+        run_length_histogram[i] += other.run_length_histogram[i];
+    }
+    return *this;
+}
+
+Stats stats(std::span<const uint8_t> rle)
+{
+    Stats stats{};
+    stats.encoded_size = rle.size();
+
+    // Run lengths are decoded in batches; runs alternate between zeros and ones.
+    std::array<uint32_t, 256> run_lengths;
+    bool value = false;
+    while (!rle.empty())
+    {
+        const auto [n_decoded, used] = codec::leb128::decode_many(rle, run_lengths);
+        for (size_t i = 0; i < n_decoded; i++)
         {
-            if (rle_buff.end() == rle_it)
-            {
-                throw std::runtime_error("rle_buff buffer too small");
-            }
+            const uint32_t run_length = run_lengths[i];
+            const bool counted = 0 != run_length;
+            stats.n_pixels += run_length;
+            stats.n_ones += value ? run_length : 0;
+            stats.n_runs += counted;
+            stats.n_one_runs += counted && value;
+            stats.run_length_histogram[std::bit_width(run_length)] += counted;
+            value = !value;
+        }
+        rle = rle.subspan(used.size());
+    } // end while
+
+    return stats;
+}
+
+std::span<uint8_t> encode(codec::bit_packed::ConstMask data, std::span<uint8_t> rle_buff)
+{
+    auto rle_it = rle_buff.begin();
+
+    codec::bit_packed::visit_runs(data, [&](size_t run_length) {
+        rle_it = encode_run(static_cast<uint32_t>(run_length), rle_buff, rle_it);
+    });
+
+    return std::span(rle_buff.begin(), rle_it);
+}
 
-            std::span<uint8_t> encoded = codec::leb128::encode(run_length, std::span(rle_it, rle_buff.end()));
-            rle_it = encoded.end();
-            run_length = 1;
-        } // end if
-        else
+// Calls write(run_length, value) for each run in rle_buff and returns the value
+// that follows the last run.
+template <typename Write>
+static bool decode_runs(std::span<const uint8_t> rle_buff, Write &&write)
+{
+    bool cur_val = 0;
+    const uint8_t* rle_it = rle_buff.data();
+    const uint8_t* const rle_end = rle_buff.data() + rle_buff.size();
+
+    while (rle_end > rle_it)
+    {
+        const uint32_t run_length = codec::leb128::decode_u32(rle_it, rle_end);
+        write(run_length, cur_val);
+        cur_val = !cur_val;
+    } // end while
+
+    return cur_val;
+}
+
+std::span<uint8_t> decode(std::span<const uint8_t> rle_buff, std::span<uint8_t> data_buff)
+{
+    uint8_t* data_it = data_buff.data();
+    uint8_t* const data_end = data_buff.data() + data_buff.size();
+
+    const bool cur_val = decode_runs(rle_buff, [&](uint32_t run_length, bool val) {
+        // Check the capacity once per run and fill the whole run in one go.
+        if (static_cast<size_t>(data_end - data_it) < run_length)
         {
-            ++run_length;
+            throw std::runtime_error("data buffer too small");
         }
-        prev_val = val;
-    } // end for val
+        // data_it is null for an empty data_buff, which memset may not be
+        // passed even with a length of zero.
+        if (0 == run_length) return;
+        std::memset(data_it, val, run_length);
+        data_it += run_length;
+    });
 
-    if (rle_buff.end() == rle_it)
+    if (data_end != data_it)
     {
-        throw std::runtime_error("rle_buff buffer too small");
+        std::memset(data_it, cur_val, data_end - data_it);
     }
 
-    std::span<uint8_t> encoded = codec::leb128::encode(run_length, std::span(rle_it, rle_buff.end()));
-    rle_it = encoded.end();
+    return data_buff;
+}
 
-    return std::span(rle_buff.begin(), rle_it);
+codec::bit_packed::Mask decode(std::span<const uint8_t> rle_buff, codec::bit_packed::Mask data_buff)
+{
+    codec::bit_packed::Writer writer(data_buff);
+
+    const bool cur_val = decode_runs(rle_buff, [&](uint32_t run_length, bool val) {
+        writer.write(run_length, val);
+    });
+
+    writer.write(writer.remaining(), cur_val);
+
+    return data_buff;
 }
 
-std::span<uint8_t> decode(std::span<const uint8_t> rle_buff, std::span<uint8_t> data_buff)
+Decoder::Decoder(std::span<const uint8_t> rle, bool initial_value) :
+    rle_it_(rle.data()),
+    rle_end_(rle.data() + rle.size()),
+    cur_val_(!initial_value),
+    run_remaining_(0)
 {
-    bool cur_val = 0;
-    auto data_it = data_buff.begin();
-    decltype(rle_buff)::iterator rle_it = rle_buff.begin();
+}
 
-    while (rle_buff.end() > rle_it)
+std::span<uint8_t> Decoder::pull(std::span<uint8_t> data_buff)
+{
+    uint8_t* data_it = data_buff.data();
+    uint8_t* const data_end = data_buff.data() + data_buff.size();
+
+    while (data_end > data_it)
     {
-        const auto [run_length, decoded_buff] = codec::leb128::decode_one<int>(std::span(rle_it, rle_buff.end()));
-        rle_it = decoded_buff.end();
-        for (size_t i = 0; i < run_length; i++)
+        if (0 == run_remaining_)
         {
-            if (data_buff.end() == data_it)
+            if (rle_it_ >= rle_end_)
             {
-                throw std::runtime_error("data buffer too small");
+                break;
             }
-            *data_it++ = cur_val;
+            run_remaining_ = codec::leb128::decode_u32(rle_it_, rle_end_);
+            cur_val_ = !cur_val_;
+            continue;
         }
-        cur_val = !cur_val;
-    } // end while
 
-    while (data_buff.end() != data_it)
-    {
-        *data_it++ = cur_val;
-    }
+        const size_t n = std::min<size_t>(run_remaining_, data_end - data_it);
+        std::memset(data_it, cur_val_, n);
+        data_it += n;
+        run_remaining_ -= n;
+    } // end while
 
-    return std::span(data_buff.begin(), data_it);
+    return std::span(data_buff.data(), data_it);
 }
 
-}
\ No newline at end of file
+}
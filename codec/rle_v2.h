@@ -1,6 +1,11 @@
 #pragma once
 
+#include "codec/bit_packed.h"
+#include "codec/leb128.h"
+#include <array>
+#include <cassert>
 #include <span>
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
@@ -9,4 +14,98 @@ namespace rle::v2 {
 std::span<uint8_t> encode(std::span<const uint8_t> data, std::span<uint8_t> rle_buff);
 std::span<uint8_t> decode(std::span<const uint8_t> rle, std::span<uint8_t> data_buff);
 
-}
\ No newline at end of file
+// Upper bound on the encoded size of any image with n_pixels pixels: every pixel
+// starts a new one-byte run, plus the leading run of zeros.
+constexpr size_t max_encoded_size(size_t n_pixels)
+{
+    return n_pixels + 1;
+}
+
+// Appends run_length to a stream being built run by run in buff, as
+// codec::leb128 encodes it. Run lengths are 32-bit.
+inline void append_run(std::vector<uint8_t> &buff, uint64_t run_length)
+{
+    assert(run_length <= UINT32_MAX);
+
+    uint8_t code[5];
+    for (uint8_t byte : codec::leb128::encode(static_cast<uint32_t>(run_length), std::span(code)))
+    {
+        buff.push_back(byte);
+    }
+}
+
+// Exact size in bytes of encode(data, ...), computed without writing the output.
+// With initial_value set, the size of the stream an Encoder(initial_value)
+// produces instead.
+size_t encoded_size(std::span<const uint8_t> data, bool initial_value = false);
+
+// Run statistics of an encoded stream. Runs of length zero, which the format
+// only uses for a leading run of ones, are not counted.
+struct Stats
+{
+    size_t n_runs;
+    size_t n_one_runs;
+    size_t n_pixels;
+    size_t n_ones;
+    size_t encoded_size;
+
+    // run_length_histogram[i] counts the runs with lengths in [2^(i-1), 2^i).
+    std::array<size_t, 33> run_length_histogram;
+
+    double bytes_per_run() const { return n_runs ? static_cast<double>(encoded_size) / n_runs : 0; }
+    double bits_per_pixel() const { return n_pixels ? 8.0 * encoded_size / n_pixels : 0; }
+
+    // Accumulates the statistics of several streams.
+    Stats& operator+=(const Stats &other);
+};
+
+// Computes the statistics of rle in a single pass over the encoded stream.
+Stats stats(std::span<const uint8_t> rle);
+
+// Bit-packed (1 bit per pixel) variants. They produce and consume the same
+// encoded stream as the byte-per-pixel versions.
+std::span<uint8_t> encode(codec::bit_packed::ConstMask data, std::span<uint8_t> rle_buff);
+codec::bit_packed::Mask decode(std::span<const uint8_t> rle, codec::bit_packed::Mask data_buff);
+
+// Incremental encoder for images that arrive a few rows at a time. The
+// concatenation of the spans returned by push() and finish() is identical to
+// encode() over the concatenated input.
+class Encoder
+{
+  public:
+    explicit Encoder(bool initial_value = false);
+
+    // Encodes the runs completed within data. The run in progress at the end of
+    // data is carried over to the next call. rle_buff needs at most
+    // max_encoded_size(data.size()) + 4 bytes.
+    std::span<uint8_t> push(std::span<const uint8_t> data, std::span<uint8_t> rle_buff);
+
+    // Encodes the final run. rle_buff needs at most 5 bytes.
+    std::span<uint8_t> finish(std::span<uint8_t> rle_buff);
+
+  private:
+    bool prev_val_;
+    uint32_t run_length_;
+};
+
+// Incremental decoder that produces an image a window at a time.
+class Decoder
+{
+  public:
+    explicit Decoder(std::span<const uint8_t> rle, bool initial_value = false);
+
+    // Decodes up to data_buff.size() pixels into data_buff and returns the part
+    // that was written. Unlike decode(), the output is not padded once the stream
+    // is exhausted; the returned span is shorter, and empty after done().
+    std::span<uint8_t> pull(std::span<uint8_t> data_buff);
+
+    bool done() const { return 0 == run_remaining_ && rle_it_ >= rle_end_; }
+
+  private:
+    const uint8_t* rle_it_;
+    const uint8_t* rle_end_;
+    bool cur_val_;
+    uint32_t run_remaining_;
+};
+
+}
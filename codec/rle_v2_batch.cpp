@@ -0,0 +1,91 @@
+#include "codec/rle_v2_batch.h"
+#include "codec/rle_v2.h"
+#include <stdexcept>
+
+namespace rle::v2::batch {
+
+size_t max_encoded_size(std::span<const std::span<const uint8_t>> data)
+{
+    size_t size = 0;
+    for (std::span<const uint8_t> image : data)
+    {
+        size += rle::v2::max_encoded_size(image.size());
+    }
+    return size;
+}
+
+std::span<uint8_t> encode(
+    std::span<const std::span<const uint8_t>> data,
+    std::span<uint8_t> arena,
+    std::span<size_t> offsets,
+    codec::ThreadPool *pool)
+{
+    if (offsets.size() != data.size() + 1)
+    {
+        throw std::runtime_error("offsets needs one more entry than there are images");
+    }
+
+    offsets[0] = 0;
+
+    if (!pool)
+    {
+        for (size_t i = 0; i < data.size(); i++)
+        {
+            offsets[i + 1] = offsets[i] + rle::v2::encode(data[i], arena.subspan(offsets[i])).size();
+        }
+        return arena.first(offsets.back());
+    }
+
+    // First pass: size every image so that they can be written in place.
+    pool->parallel_for(data.size(), [&](size_t i) {
+        offsets[i + 1] = encoded_size(data[i]);
+    });
+
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        offsets[i + 1] += offsets[i];
+    }
+    if (offsets.back() > arena.size())
+    {
+        throw std::runtime_error("rle_buff buffer too small");
+    }
+
+    pool->parallel_for(data.size(), [&](size_t i) {
+        rle::v2::encode(data[i], arena.subspan(offsets[i], offsets[i + 1] - offsets[i]));
+    });
+
+    return arena.first(offsets.back());
+}
+
+void decode(
+    std::span<const uint8_t> arena,
+    std::span<const size_t> offsets,
+    std::span<const std::span<uint8_t>> data_buffs,
+    codec::ThreadPool *pool)
+{
+    if (offsets.size() != data_buffs.size() + 1)
+    {
+        throw std::runtime_error("offsets needs one more entry than there are images");
+    }
+
+    auto decode_one = [&](size_t i) {
+        if (offsets[i] > offsets[i + 1] || offsets[i + 1] > arena.size())
+        {
+            throw std::runtime_error("offsets out of bounds of the arena");
+        }
+        rle::v2::decode(arena.subspan(offsets[i], offsets[i + 1] - offsets[i]), data_buffs[i]);
+    };
+
+    if (pool)
+    {
+        pool->parallel_for(data_buffs.size(), decode_one);
+        return;
+    }
+
+    for (size_t i = 0; i < data_buffs.size(); i++)
+    {
+        decode_one(i);
+    }
+}
+
+}
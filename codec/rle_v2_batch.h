@@ -0,0 +1,33 @@
+#pragma once
+
+#include "codec/thread_pool.h"
+#include <span>
+#include <cstddef>
+#include <cstdint>
+
+// Batches of small images, e.g. per-object instance masks, encoded back to back
+// into one arena. Stream i occupies arena[offsets[i], offsets[i + 1]) and is a
+// plain v2 stream, so it can be wrapped in a SparseImage without copying.
+namespace rle::v2::batch {
+
+// Upper bound on the arena size needed to encode data.
+size_t max_encoded_size(std::span<const std::span<const uint8_t>> data);
+
+// Encodes every image in data into arena and fills offsets, which needs
+// data.size() + 1 entries. Returns the written part of arena. With a pool, the
+// images are encoded in parallel after a first pass that sizes them.
+std::span<uint8_t> encode(
+    std::span<const std::span<const uint8_t>> data,
+    std::span<uint8_t> arena,
+    std::span<size_t> offsets,
+    codec::ThreadPool *pool = nullptr);
+
+// Decodes stream i of arena into data_buffs[i], which must be the size of the
+// encoded image.
+void decode(
+    std::span<const uint8_t> arena,
+    std::span<const size_t> offsets,
+    std::span<const std::span<uint8_t>> data_buffs,
+    codec::ThreadPool *pool = nullptr);
+
+}
@@ -0,0 +1,176 @@
+#include "codec/rle_v2_framed.h"
+#include "codec/leb128.h"
+#include "codec/rle_v2.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace rle::v2::framed {
+
+static size_t num_bands(size_t n_pixels, size_t band_size)
+{
+    return (n_pixels + band_size - 1) / band_size;
+}
+
+static void write_u32(uint8_t *p, uint32_t val)
+{
+    for (size_t i = 0; i < 4; i++)
+    {
+        p[i] = static_cast<uint8_t>(val >> (8 * i));
+    }
+}
+
+static uint32_t read_u32(const uint8_t *p)
+{
+    uint32_t val = 0;
+    for (size_t i = 0; i < 4; i++)
+    {
+        val |= static_cast<uint32_t>(p[i]) << (8 * i);
+    }
+    return val;
+}
+
+// Calls f(band_i) for each band, spread over pool when there is one.
+template <typename F>
+static void for_each_band(size_t n_bands, codec::ThreadPool *pool, F &&f)
+{
+    if (pool)
+    {
+        pool->parallel_for(n_bands, f);
+        return;
+    }
+
+    for (size_t band_i = 0; band_i < n_bands; band_i++)
+    {
+        f(band_i);
+    }
+}
+
+size_t max_encoded_size(size_t n_pixels, size_t band_size)
+{
+    const size_t n_bands = band_size ? num_bands(n_pixels, band_size) : 0;
+    return codec::leb128::encoded_size(n_pixels)
+        + codec::leb128::encoded_size(band_size)
+        + n_bands * (sizeof(uint32_t) + 1)
+        + n_pixels + n_bands;
+}
+
+std::span<uint8_t> encode(
+    std::span<const uint8_t> data,
+    size_t band_size,
+    std::span<uint8_t> rle_buff,
+    codec::ThreadPool *pool)
+{
+    if (0 == band_size)
+    {
+        throw std::runtime_error("band_size must be positive");
+    }
+
+    const size_t n_pixels = data.size();
+    const size_t n_bands = num_bands(n_pixels, band_size);
+    auto band = [&](size_t band_i) {
+        return data.subspan(band_i * band_size, std::min(band_size, n_pixels - band_i * band_size));
+    };
+
+    // First pass: size every band so that the bands can be written in place.
+    std::vector<size_t> band_sizes(n_bands);
+    std::vector<uint8_t> start_values(n_bands);
+    for_each_band(n_bands, pool, [&](size_t band_i) {
+        start_values[band_i] = 0 != band(band_i).front();
+        band_sizes[band_i] = encoded_size(band(band_i), start_values[band_i]);
+    });
+
+    auto rle_it = rle_buff.begin();
+    rle_it = codec::leb128::encode(n_pixels, rle_buff).end();
+    rle_it = codec::leb128::encode(band_size, std::span(rle_it, rle_buff.end())).end();
+
+    const size_t table_begin = rle_it - rle_buff.begin();
+    const size_t streams_begin = table_begin + n_bands * (sizeof(uint32_t) + 1);
+
+    std::vector<size_t> offsets(n_bands);
+    size_t streams_size = 0;
+    for (size_t band_i = 0; band_i < n_bands; band_i++)
+    {
+        offsets[band_i] = streams_size;
+        streams_size += band_sizes[band_i];
+    }
+
+    if (streams_size > std::numeric_limits<uint32_t>::max())
+    {
+        throw std::runtime_error("encoded image too large for the band offset table");
+    }
+    if (streams_begin + streams_size > rle_buff.size())
+    {
+        throw std::runtime_error("rle_buff buffer too small");
+    }
+
+    for (size_t band_i = 0; band_i < n_bands; band_i++)
+    {
+        write_u32(rle_buff.data() + table_begin + band_i * sizeof(uint32_t), static_cast<uint32_t>(offsets[band_i]));
+        rle_buff[table_begin + n_bands * sizeof(uint32_t) + band_i] = start_values[band_i];
+    }
+
+    // Second pass: encode the bands independently.
+    for_each_band(n_bands, pool, [&](size_t band_i) {
+        std::span<uint8_t> out = rle_buff.subspan(streams_begin + offsets[band_i], band_sizes[band_i]);
+        Encoder encoder(start_values[band_i]);
+        const size_t n_pushed = encoder.push(band(band_i), out).size();
+        encoder.finish(out.subspan(n_pushed));
+    });
+
+    return rle_buff.first(streams_begin + streams_size);
+}
+
+std::span<uint8_t> decode(
+    std::span<const uint8_t> rle,
+    std::span<uint8_t> data_buff,
+    codec::ThreadPool *pool)
+{
+    const auto [n_pixels, encoded_n_pixels] = codec::leb128::decode_one<uint64_t>(rle);
+    const auto [band_size, encoded_band_size] = codec::leb128::decode_one<uint64_t>(rle.subspan(encoded_n_pixels.size()));
+
+    if (0 == band_size)
+    {
+        throw std::runtime_error("band_size must be positive");
+    }
+    if (data_buff.size() < n_pixels)
+    {
+        throw std::runtime_error("data buffer too small");
+    }
+
+    const size_t n_bands = num_bands(n_pixels, band_size);
+    const size_t table_begin = encoded_n_pixels.size() + encoded_band_size.size();
+    const size_t streams_begin = table_begin + n_bands * (sizeof(uint32_t) + 1);
+    if (streams_begin > rle.size())
+    {
+        throw std::runtime_error("unexpectedly reached end of buffer");
+    }
+
+    const std::span<const uint8_t> streams = rle.subspan(streams_begin);
+    auto offset = [&](size_t band_i) -> size_t {
+        return band_i < n_bands ? read_u32(rle.data() + table_begin + band_i * sizeof(uint32_t)) : streams.size();
+    };
+
+    for_each_band(n_bands, pool, [&](size_t band_i) {
+        const size_t stream_begin = offset(band_i);
+        const size_t stream_end = offset(band_i + 1);
+        if (stream_begin > stream_end || stream_end > streams.size())
+        {
+            throw std::runtime_error("corrupt band offset table");
+        }
+
+        const bool start_value = rle[table_begin + n_bands * sizeof(uint32_t) + band_i];
+        Decoder decoder(streams.subspan(stream_begin, stream_end - stream_begin), start_value);
+
+        std::span<uint8_t> out = data_buff.subspan(band_i * band_size, std::min<size_t>(band_size, n_pixels - band_i * band_size));
+        if (decoder.pull(out).size() != out.size())
+        {
+            throw std::runtime_error("band stream too short");
+        }
+    });
+
+    return data_buff.first(n_pixels);
+}
+
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "codec/thread_pool.h"
+#include <span>
+#include <cstddef>
+#include <cstdint>
+
+// Framed variant of the v2 format for large images. The image is split into
+// bands of band_size pixels (usually width * rows_per_band) that are encoded as
+// independent v2 streams, so bands can be encoded and decoded in parallel.
+//
+// Layout:
+//   LEB128 n_pixels
+//   LEB128 band_size
+//   uint32_t offset[n_bands]     little endian, start of each band's stream
+//                                relative to the end of the header
+//   uint8_t start_value[n_bands] value of the first pixel of each band
+//   band streams                 v2 streams that start with start_value
+namespace rle::v2::framed {
+
+// Upper bound on the size of encode() for an image of n_pixels pixels.
+size_t max_encoded_size(size_t n_pixels, size_t band_size);
+
+// Encodes data and returns the written part of rle_buff. Bands are spread over
+// pool when one is given.
+std::span<uint8_t> encode(
+    std::span<const uint8_t> data,
+    size_t band_size,
+    std::span<uint8_t> rle_buff,
+    codec::ThreadPool *pool = nullptr);
+
+// Decodes a framed stream into the first n_pixels bytes of data_buff and
+// returns them.
+std::span<uint8_t> decode(
+    std::span<const uint8_t> rle,
+    std::span<uint8_t> data_buff,
+    codec::ThreadPool *pool = nullptr);
+
+}
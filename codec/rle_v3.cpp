@@ -0,0 +1,181 @@
+#include "codec/rle_v3.h"
+#include "codec/leb128.h"
+#include "codec/run_scan.h"
+#include <array>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__SSSE3__)
+#include <immintrin.h>
+#endif
+
+namespace rle::v3 {
+
+static uint8_t length_code(uint32_t run_length)
+{
+    return (run_length >> 8 ? 1 : 0) + (run_length >> 16 ? 1 : 0) + (run_length >> 24 ? 1 : 0);
+}
+
+#if defined(__SSSE3__)
+// Number of data bytes used by the 4 runs described by a control byte.
+static constexpr std::array<uint8_t, 256> make_data_lengths()
+{
+    std::array<uint8_t, 256> data_lengths{};
+    for (size_t control = 0; control < 256; control++)
+    {
+        for (size_t i = 0; i < 4; i++)
+        {
+            data_lengths[control] += ((control >> (2 * i)) & 0x3) + 1;
+        }
+    }
+    return data_lengths;
+}
+
+static constexpr std::array<uint8_t, 256> data_lengths = make_data_lengths();
+
+// pshufb masks that spread the data bytes of 4 runs into 4 uint32_t lanes.
+static constexpr std::array<std::array<int8_t, 16>, 256> make_shuffle_masks()
+{
+    std::array<std::array<int8_t, 16>, 256> masks{};
+    for (size_t control = 0; control < 256; control++)
+    {
+        int8_t src = 0;
+        for (size_t i = 0; i < 4; i++)
+        {
+            const size_t n_bytes = ((control >> (2 * i)) & 0x3) + 1;
+            for (size_t b = 0; b < 4; b++)
+            {
+                masks[control][4 * i + b] = b < n_bytes ? src++ : -1;
+            }
+        }
+    }
+    return masks;
+}
+
+alignas(16) static constexpr std::array<std::array<int8_t, 16>, 256> shuffle_masks = make_shuffle_masks();
+#endif
+
+size_t max_encoded_size(size_t n_pixels)
+{
+    // At most one run per pixel plus the leading run of zeros, and a run of
+    // length L never needs more than max(L, 1) data bytes.
+    const size_t max_runs = n_pixels + 1;
+    return codec::leb128::encoded_size(max_runs) + (max_runs + 3) / 4 + n_pixels + 1;
+}
+
+std::span<uint8_t> encode(std::span<const uint8_t> data, std::span<uint8_t> rle_buff)
+{
+    // First pass: count the runs to find where the data stream starts.
+    size_t n_runs = 1;
+    {
+        bool prev_val = false;
+        uint32_t run_length = 0;
+        codec::run_scan::scan_runs(data, prev_val, run_length, [&](uint32_t) { ++n_runs; });
+    }
+
+    const size_t header_size = codec::leb128::encode(n_runs, rle_buff).size();
+    const size_t control_size = (n_runs + 3) / 4;
+    if (header_size + control_size > rle_buff.size())
+    {
+        throw std::runtime_error("rle_buff buffer too small");
+    }
+
+    uint8_t* const control = rle_buff.data() + header_size;
+    std::memset(control, 0, control_size);
+    uint8_t* data_it = control + control_size;
+    uint8_t* const data_end = rle_buff.data() + rle_buff.size();
+
+    size_t run_i = 0;
+    auto emit = [&](uint32_t run_length) {
+        const uint8_t code = length_code(run_length);
+        if (static_cast<size_t>(data_end - data_it) < code + 1u)
+        {
+            throw std::runtime_error("rle_buff buffer too small");
+        }
+        control[run_i / 4] |= code << (2 * (run_i % 4));
+        for (size_t b = 0; b <= code; b++)
+        {
+            *data_it++ = static_cast<uint8_t>(run_length >> (8 * b));
+        }
+        ++run_i;
+    };
+
+    // Second pass: write the control and data streams.
+    bool prev_val = false;
+    uint32_t run_length = 0;
+    codec::run_scan::scan_runs(data, prev_val, run_length, emit);
+    emit(run_length);
+
+    return std::span(rle_buff.data(), data_it);
+}
+
+std::span<uint8_t> decode(std::span<const uint8_t> rle_buff, std::span<uint8_t> data_buff)
+{
+    const auto [n_runs, encoded_n_runs] = codec::leb128::decode_one<uint64_t>(rle_buff);
+
+    const size_t control_size = (n_runs + 3) / 4;
+    if (encoded_n_runs.size() + control_size > rle_buff.size())
+    {
+        throw std::runtime_error("unexpectedly reached end of buffer");
+    }
+
+    const uint8_t* const control = rle_buff.data() + encoded_n_runs.size();
+    const uint8_t* rle_it = control + control_size;
+    const uint8_t* const rle_end = rle_buff.data() + rle_buff.size();
+
+    bool cur_val = 0;
+    uint8_t* data_it = data_buff.data();
+    uint8_t* const data_end = data_buff.data() + data_buff.size();
+
+    auto write = [&](uint32_t run_length) {
+        if (static_cast<size_t>(data_end - data_it) < run_length)
+        {
+            throw std::runtime_error("data buffer too small");
+        }
+        std::memset(data_it, cur_val, run_length);
+        data_it += run_length;
+        cur_val = !cur_val;
+    };
+
+    size_t run_i = 0;
+
+#if defined(__SSSE3__)
+    // Decode 4 run lengths per shuffle while 16 data bytes can be loaded.
+    alignas(16) uint32_t run_lengths[4];
+    for (; run_i + 4 <= n_runs && rle_end - rle_it >= 16; run_i += 4)
+    {
+        const uint8_t control_byte = control[run_i / 4];
+        const __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rle_it));
+        const __m128i mask = _mm_load_si128(reinterpret_cast<const __m128i*>(shuffle_masks[control_byte].data()));
+        _mm_store_si128(reinterpret_cast<__m128i*>(run_lengths), _mm_shuffle_epi8(packed, mask));
+        rle_it += data_lengths[control_byte];
+
+        write(run_lengths[0]);
+        write(run_lengths[1]);
+        write(run_lengths[2]);
+        write(run_lengths[3]);
+    }
+#endif
+
+    for (; run_i < n_runs; run_i++)
+    {
+        const size_t n_bytes = ((control[run_i / 4] >> (2 * (run_i % 4))) & 0x3) + 1;
+        if (static_cast<size_t>(rle_end - rle_it) < n_bytes)
+        {
+            throw std::runtime_error("unexpectedly reached end of buffer");
+        }
+
+        uint32_t run_length = 0;
+        for (size_t b = 0; b < n_bytes; b++)
+        {
+            run_length |= static_cast<uint32_t>(*rle_it++) << (8 * b);
+        }
+        write(run_length);
+    }
+
+    std::memset(data_it, cur_val, data_end - data_it);
+
+    return data_buff;
+}
+
+}
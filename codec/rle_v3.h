@@ -0,0 +1,21 @@
+#pragma once
+
+#include <span>
+#include <cstddef>
+#include <cstdint>
+
+// Run lengths as in v2, stored in a Stream VByte layout so that they can be
+// decoded several at a time with byte shuffles:
+//   LEB128 n_runs
+//   control stream: one byte per 4 runs, 2 bits per run holding the number of
+//                   data bytes minus one, least significant bits first
+//   data stream:    run lengths as 1 to 4 little-endian bytes
+namespace rle::v3 {
+
+std::span<uint8_t> encode(std::span<const uint8_t> data, std::span<uint8_t> rle_buff);
+std::span<uint8_t> decode(std::span<const uint8_t> rle, std::span<uint8_t> data_buff);
+
+// Upper bound on the encoded size of any image with n_pixels pixels.
+size_t max_encoded_size(size_t n_pixels);
+
+}
@@ -0,0 +1,292 @@
+#include "codec/rle_v4.h"
+#include "codec/bit_stream.h"
+#include "codec/leb128.h"
+#include "codec/run_scan.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+#include <vector>
+
+namespace rle::v4 {
+
+static constexpr size_t n_symbols = 44;
+static constexpr unsigned max_code_length = 11;
+static constexpr size_t code_lengths_size = n_symbols / 2;
+
+using Histogram = std::array<uint64_t, n_symbols>;
+using CodeLengths = std::array<uint8_t, n_symbols>;
+using Codes = std::array<uint16_t, n_symbols>;
+
+struct DecodeEntry
+{
+    uint8_t symbol;
+    uint8_t length;
+};
+
+using DecodeTable = std::array<DecodeEntry, 1 << max_code_length>;
+
+static uint8_t symbol(uint32_t run_length)
+{
+    return run_length < 16 ? run_length : 16 + std::bit_width(run_length) - 5;
+}
+
+// Number of bits stored verbatim after the code of a symbol: all but the
+// leading one of the run length.
+static unsigned extra_bits(uint8_t symbol)
+{
+    return symbol < 16 ? 0 : symbol - 12;
+}
+
+// Huffman code lengths limited to max_code_length. When the tree is too deep
+// the counts are halved, which flattens it, and the tree is rebuilt.
+static CodeLengths make_code_lengths(Histogram counts)
+{
+    while (true)
+    {
+        CodeLengths lengths{};
+
+        using Node = std::pair<uint64_t, size_t>;
+        std::priority_queue<Node, std::vector<Node>, std::greater<>> queue;
+        std::vector<size_t> parent;
+        std::vector<size_t> leaf_symbols;
+        for (size_t s = 0; s < n_symbols; s++)
+        {
+            if (counts[s])
+            {
+                queue.push({counts[s], parent.size()});
+                parent.push_back(0);
+                leaf_symbols.push_back(s);
+            }
+        }
+
+        if (queue.size() <= 1)
+        {
+            for (const size_t s : leaf_symbols) lengths[s] = 1;
+            return lengths;
+        }
+
+        while (queue.size() > 1)
+        {
+            const Node a = queue.top();
+            queue.pop();
+            const Node b = queue.top();
+            queue.pop();
+            parent[a.second] = parent.size();
+            parent[b.second] = parent.size();
+            queue.push({a.first + b.first, parent.size()});
+            parent.push_back(0);
+        }
+        const size_t root = parent.size() - 1;
+
+        unsigned max_length = 0;
+        for (size_t leaf = 0; leaf < leaf_symbols.size(); leaf++)
+        {
+            unsigned length = 0;
+            for (size_t node = leaf; node != root; node = parent[node]) ++length;
+            lengths[leaf_symbols[leaf]] = length;
+            max_length = std::max(max_length, length);
+        }
+
+        if (max_length <= max_code_length)
+        {
+            return lengths;
+        }
+
+        for (uint64_t &count : counts)
+        {
+            count = (count + 1) / 2;
+        }
+    }
+}
+
+// Canonical codes, bit-reversed for the least-significant-bit-first stream.
+static Codes make_codes(const CodeLengths &lengths)
+{
+    std::array<uint16_t, max_code_length + 1> length_counts{};
+    for (const uint8_t length : lengths)
+    {
+        if (length) ++length_counts[length];
+    }
+
+    std::array<uint16_t, max_code_length + 1> next_code{};
+    uint16_t code = 0;
+    for (unsigned length = 1; length <= max_code_length; length++)
+    {
+        code = (code + length_counts[length - 1]) << 1;
+        next_code[length] = code;
+    }
+
+    Codes codes{};
+    for (size_t s = 0; s < n_symbols; s++)
+    {
+        const uint8_t length = lengths[s];
+        if (!length) continue;
+
+        const uint16_t canonical = next_code[length]++;
+        uint16_t reversed = 0;
+        for (unsigned bit = 0; bit < length; bit++)
+        {
+            reversed |= ((canonical >> bit) & 1) << (length - 1 - bit);
+        }
+        codes[s] = reversed;
+    }
+    return codes;
+}
+
+static void make_decode_table(const CodeLengths &lengths, DecodeTable &table)
+{
+    uint32_t kraft_sum = 0;
+    for (const uint8_t length : lengths)
+    {
+        if (length > max_code_length)
+        {
+            throw std::runtime_error("corrupt code lengths");
+        }
+        if (length) kraft_sum += 1u << (max_code_length - length);
+    }
+    if (kraft_sum > (1u << max_code_length))
+    {
+        throw std::runtime_error("corrupt code lengths");
+    }
+
+    table.fill({0, 0});
+    const Codes codes = make_codes(lengths);
+    for (size_t s = 0; s < n_symbols; s++)
+    {
+        const uint8_t length = lengths[s];
+        if (!length) continue;
+
+        for (uint32_t fill = 0; fill < (1u << (max_code_length - length)); fill++)
+        {
+            table[codes[s] | (fill << length)] = {static_cast<uint8_t>(s), length};
+        }
+    }
+}
+
+size_t max_encoded_size(size_t n_pixels)
+{
+    // At most n_pixels + 1 runs of at most max_code_length bits each, plus the
+    // verbatim bits, which never add up to more than one per pixel.
+    const size_t max_runs = n_pixels + 1;
+    return codec::leb128::encoded_size(max_runs)
+        + 2 * code_lengths_size
+        + (max_code_length * max_runs + n_pixels + 7) / 8;
+}
+
+std::span<uint8_t> encode(std::span<const uint8_t> data, std::span<uint8_t> rle_buff)
+{
+    // First pass: histogram of the run length symbols of each value.
+    std::array<Histogram, 2> histograms{};
+    size_t n_runs = 0;
+    auto count = [&](uint32_t run_length) {
+        ++histograms[n_runs % 2][symbol(run_length)];
+        ++n_runs;
+    };
+
+    bool prev_val = false;
+    uint32_t run_length = 0;
+    codec::run_scan::scan_runs(data, prev_val, run_length, count);
+    count(run_length);
+
+    const std::array<CodeLengths, 2> lengths{make_code_lengths(histograms[0]), make_code_lengths(histograms[1])};
+    const std::array<Codes, 2> codes{make_codes(lengths[0]), make_codes(lengths[1])};
+
+    auto rle_it = codec::leb128::encode(n_runs, rle_buff).end();
+    if (static_cast<size_t>(rle_buff.end() - rle_it) < 2 * code_lengths_size)
+    {
+        throw std::runtime_error("rle_buff buffer too small");
+    }
+    for (const CodeLengths &table_lengths : lengths)
+    {
+        for (size_t s = 0; s < n_symbols; s += 2)
+        {
+            *rle_it++ = table_lengths[s] | (table_lengths[s + 1] << 4);
+        }
+    }
+
+    // Second pass: write the codes.
+    codec::bit_stream::Writer writer(std::span(rle_it, rle_buff.end()));
+    size_t run_i = 0;
+    auto emit = [&](uint32_t run_length) {
+        const size_t table_i = run_i++ % 2;
+        const uint8_t s = symbol(run_length);
+        writer.write(codes[table_i][s], lengths[table_i][s]);
+        if (const unsigned n_extra = extra_bits(s))
+        {
+            writer.write(run_length, n_extra);
+        }
+    };
+
+    prev_val = false;
+    run_length = 0;
+    codec::run_scan::scan_runs(data, prev_val, run_length, emit);
+    emit(run_length);
+
+    const std::span<uint8_t> bits = writer.finish();
+
+    return std::span(rle_buff.begin(), bits.end());
+}
+
+std::span<uint8_t> decode(std::span<const uint8_t> rle_buff, std::span<uint8_t> data_buff)
+{
+    const auto [n_runs, encoded_n_runs] = codec::leb128::decode_one<uint64_t>(rle_buff);
+    rle_buff = rle_buff.subspan(encoded_n_runs.size());
+
+    if (rle_buff.size() < 2 * code_lengths_size)
+    {
+        throw std::runtime_error("unexpectedly reached end of buffer");
+    }
+
+    std::array<DecodeTable, 2> tables;
+    for (size_t table_i = 0; table_i < 2; table_i++)
+    {
+        CodeLengths lengths;
+        for (size_t s = 0; s < n_symbols; s += 2)
+        {
+            const uint8_t packed = rle_buff[table_i * code_lengths_size + s / 2];
+            lengths[s] = packed & 0xf;
+            lengths[s + 1] = packed >> 4;
+        }
+        make_decode_table(lengths, tables[table_i]);
+    }
+
+    codec::bit_stream::Reader reader(rle_buff.subspan(2 * code_lengths_size));
+
+    bool cur_val = 0;
+    uint8_t* data_it = data_buff.data();
+    uint8_t* const data_end = data_buff.data() + data_buff.size();
+
+    for (size_t run_i = 0; run_i < n_runs; run_i++)
+    {
+        const DecodeEntry entry = tables[run_i % 2][reader.peek(max_code_length)];
+        if (!entry.length)
+        {
+            throw std::runtime_error("invalid code");
+        }
+        reader.consume(entry.length);
+
+        uint32_t run_length = entry.symbol;
+        if (const unsigned n_extra = extra_bits(entry.symbol))
+        {
+            run_length = (1u << n_extra) | reader.read(n_extra);
+        }
+
+        if (static_cast<size_t>(data_end - data_it) < run_length)
+        {
+            throw std::runtime_error("data buffer too small");
+        }
+        std::memset(data_it, cur_val, run_length);
+        data_it += run_length;
+        cur_val = !cur_val;
+    }
+
+    std::memset(data_it, cur_val, data_end - data_it);
+
+    return data_buff;
+}
+
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <span>
+#include <cstddef>
+#include <cstdint>
+
+// Entropy-coded runs for archival storage. Run lengths are mapped to 44
+// symbols (lengths 0-15 directly, longer lengths by bit width followed by the
+// remaining bits verbatim) and coded with per-image canonical Huffman codes.
+// Runs of zeros and runs of ones use separate codes.
+//   LEB128 n_runs
+//   44 code lengths for runs of zeros, then 44 for runs of ones, 4 bits each
+//   bit stream, least significant bit first
+namespace rle::v4 {
+
+std::span<uint8_t> encode(std::span<const uint8_t> data, std::span<uint8_t> rle_buff);
+std::span<uint8_t> decode(std::span<const uint8_t> rle, std::span<uint8_t> data_buff);
+
+// Upper bound on the encoded size of any image with n_pixels pixels.
+size_t max_encoded_size(size_t n_pixels);
+
+}
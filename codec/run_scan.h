@@ -0,0 +1,124 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace codec::run_scan
+{
+
+// Returns a pointer to the first byte in [first, last) that is not equal to val,
+// or last if every byte matches. Compares 32 (AVX2) or 16 (SSE2) bytes at a time
+// and jumps to the mismatch with a count-trailing-zeros on the movemask.
+inline const uint8_t* find_mismatch(const uint8_t* first, const uint8_t* last, uint8_t val)
+{
+#if defined(__AVX2__)
+    const __m256i needle_256 = _mm256_set1_epi8(static_cast<char>(val));
+    while (last - first >= 32)
+    {
+        const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+        const uint32_t mismatch = ~static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, needle_256)));
+        if (mismatch)
+        {
+            return first + std::countr_zero(mismatch);
+        }
+        first += 32;
+    }
+#endif
+
+#if defined(__SSE2__)
+    const __m128i needle_128 = _mm_set1_epi8(static_cast<char>(val));
+    while (last - first >= 16)
+    {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+        const uint32_t mismatch = ~static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle_128))) & 0xffff;
+        if (mismatch)
+        {
+            return first + std::countr_zero(mismatch);
+        }
+        first += 16;
+    }
+#endif
+
+    // Scalar fallback, also handles the tail.
+    while (first != last && *first == val)
+    {
+        ++first;
+    }
+    return first;
+}
+
+// Returns a pointer to the first element in [first, last) that is not equal to
+// val, or last if every element matches. 16-bit variant of the above.
+inline const uint16_t* find_mismatch(const uint16_t* first, const uint16_t* last, uint16_t val)
+{
+#if defined(__AVX2__)
+    const __m256i needle_256 = _mm256_set1_epi16(static_cast<short>(val));
+    while (last - first >= 16)
+    {
+        const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+        const uint32_t mismatch = ~static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(chunk, needle_256)));
+        if (mismatch)
+        {
+            return first + std::countr_zero(mismatch) / 2;
+        }
+        first += 16;
+    }
+#endif
+
+#if defined(__SSE2__)
+    const __m128i needle_128 = _mm_set1_epi16(static_cast<short>(val));
+    while (last - first >= 8)
+    {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+        const uint32_t mismatch = ~static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi16(chunk, needle_128))) & 0xffff;
+        if (mismatch)
+        {
+            return first + std::countr_zero(mismatch) / 2;
+        }
+        first += 8;
+    }
+#endif
+
+    while (first != last && *first == val)
+    {
+        ++first;
+    }
+    return first;
+}
+
+// Calls emit(run_length) for each run in data that is terminated by a
+// transition, starting from prev_val and a pending run of run_length pixels.
+// On return prev_val and run_length describe the trailing, unterminated run.
+template <typename Emit>
+void scan_runs(std::span<const uint8_t> data, bool &prev_val, uint32_t &run_length, Emit &&emit)
+{
+    const uint8_t* run_begin = data.data();
+    const uint8_t* it = data.data();
+    const uint8_t* const end = data.data() + data.size();
+
+    // Jump from one transition to the next instead of comparing byte by byte.
+    while (true)
+    {
+        const uint8_t* transition = find_mismatch(it, end, prev_val);
+        if (end == transition)
+        {
+            break;
+        }
+
+        emit(run_length + static_cast<uint32_t>(transition - run_begin));
+        run_length = 0;
+        prev_val = *transition;
+        run_begin = transition;
+        it = transition + 1;
+    } // end while
+
+    run_length += static_cast<uint32_t>(end - run_begin);
+}
+
+}
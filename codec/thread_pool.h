@@ -0,0 +1,109 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace codec
+{
+
+// Fixed-size pool of worker threads for data-parallel loops.
+class ThreadPool
+{
+  public:
+    explicit ThreadPool(size_t n_threads = std::thread::hardware_concurrency());
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    size_t size() const { return threads_.size(); }
+
+    // Calls f(i) for every i in [0, n) and blocks until all calls have returned.
+    // The calling thread takes part in the work and never waits on queued tasks,
+    // so nested calls cannot deadlock. If any call throws, the remaining indices
+    // are skipped and the first exception is rethrown here.
+    template <typename F>
+    void parallel_for(size_t n, F &&f);
+
+  private:
+    void submit(std::function<void()> task);
+    void worker();
+
+    std::vector<std::thread> threads_;
+    std::deque<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stop_;
+};
+
+template <typename F>
+void ThreadPool::parallel_for(size_t n, F &&f)
+{
+    // Shared with the helper tasks, which may start after this call has returned
+    // and then find no indices left to claim.
+    struct State
+    {
+        std::atomic<size_t> next{0};
+        std::atomic<bool> failed{false};
+        size_t n_done{0};
+        std::exception_ptr exception;
+        std::mutex mutex;
+        std::condition_variable done;
+    };
+    auto state = std::make_shared<State>();
+
+    auto run = [state, &f, n]() {
+        size_t n_done = 0;
+        for (size_t i = state->next++; i < n; i = state->next++)
+        {
+            if (!state->failed)
+            {
+                try
+                {
+                    f(i);
+                }
+                catch (...)
+                {
+                    std::lock_guard lock(state->mutex);
+                    if (!state->exception) state->exception = std::current_exception();
+                    state->failed = true;
+                }
+            }
+            ++n_done;
+        }
+
+        if (n_done)
+        {
+            std::lock_guard lock(state->mutex);
+            state->n_done += n_done;
+            if (n == state->n_done) state->done.notify_all();
+        }
+    };
+
+    const size_t n_helpers = std::min(size(), n > 0 ? n - 1 : 0);
+    for (size_t i = 0; i < n_helpers; i++)
+    {
+        submit(run);
+    }
+
+    run();
+
+    std::unique_lock lock(state->mutex);
+    state->done.wait(lock, [&state, n]() { return n == state->n_done; });
+
+    if (state->exception)
+    {
+        std::rethrow_exception(state->exception);
+    }
+}
+
+}
@@ -9,3 +9,7 @@ using ImArray = Eigen::Array<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
 template <typename T=float>
 requires std::is_arithmetic_v<T>
 using ImArrayRef = Eigen::Ref<ImArray<T>>;
+
+template <typename T=float>
+requires std::is_arithmetic_v<T>
+using ImArrayConstRef = Eigen::Ref<const ImArray<T>>;
@@ -108,6 +108,17 @@ struct BinaryOp<SparseImage<T_LhsPx>, SparseImage<T_RhsPx>, T_Op> :
         auto op = Base::op;
         const auto default_value = T_LhsPx{};
 
+        // Binary images are combined run by run and the runs written out whole.
+        if constexpr (std::same_as<T_LhsPx, bool> && std::same_as<T_RhsPx, bool>)
+        {
+            const SparseImage<bool> combined = combine(lhs, rhs, op);
+            for (const RowRun &run : combined.runs())
+            {
+                out.derived().row(run.v).segment(run.u_begin, run.u_end - run.u_begin).setConstant(run.value);
+            }
+            return;
+        }
+
         auto it_lhs = lhs.begin();
         auto it_rhs = rhs.begin();
 
@@ -143,6 +154,18 @@ struct BinaryOp<SparseImage<T_LhsPx>, SparseImage<T_RhsPx>, T_Op> :
     { 
         return allocate_result_and_eval(*this, alloc);
     }
+
+    // Evaluates to a SparseImage by merging the run streams of both sides,
+    // without a dense buffer. See combine(). eval() and eval_to() keep
+    // producing dense arrays like every other BinaryOp, since that is what
+    // expressions built on them consume, so skipping the dense buffer is
+    // opt-in through this method. For binary images they still merge runs
+    // rather than pixels.
+    SparseImage<bool> eval_sparse() const
+    requires std::same_as<T_LhsPx, bool> && std::same_as<T_RhsPx, bool>
+    {
+        return combine(Base::lhs, Base::rhs, Base::op);
+    }
 };
 
 template <typename T_LhsPx, typename T_Rhs, typename T_Op>
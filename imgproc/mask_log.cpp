@@ -0,0 +1,210 @@
+#include "imgproc/mask_log.h"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/stat.h>
+#include <unistd.h>
+
+std::filesystem::path mask_log_index_path(const std::filesystem::path &path)
+{
+    std::filesystem::path index_path = path;
+    index_path += ".idx";
+    return index_path;
+}
+
+static void write_all(int fd, const void *data, size_t size)
+{
+    const char *it = static_cast<const char*>(data);
+    while (size)
+    {
+        const ssize_t n_written = ::write(fd, it, size);
+        if (n_written < 0)
+        {
+            if (EINTR == errno) continue;
+            throw std::runtime_error(std::string("failed to write mask log: ") + std::strerror(errno));
+        }
+        it += n_written;
+        size -= n_written;
+    }
+}
+
+static uint64_t file_size(int fd)
+{
+    struct stat st;
+    if (::fstat(fd, &st) < 0)
+    {
+        throw std::runtime_error(std::string("failed to stat mask log: ") + std::strerror(errno));
+    }
+    return st.st_size;
+}
+
+static void check_index_header(std::span<const uint8_t> index)
+{
+    MaskLogIndexHeader header;
+    if (index.size() < sizeof(header))
+    {
+        throw std::runtime_error("mask log index too small for its header");
+    }
+    std::memcpy(&header, index.data(), sizeof(header));
+    if (header.magic != mask_log_magic)
+    {
+        throw std::runtime_error("not a mask log index");
+    }
+    if (header.version != mask_log_version)
+    {
+        throw std::runtime_error("unsupported mask log version");
+    }
+    if (header.codec != sparse_image_file_codec_v2)
+    {
+        throw std::runtime_error("unsupported mask log codec");
+    }
+}
+
+MaskLogWriter::MaskLogWriter(const std::filesystem::path &path) :
+    data_fd_(-1),
+    index_fd_(-1),
+    data_size_(),
+    n_frames_()
+{
+    const std::filesystem::path index_path = mask_log_index_path(path);
+
+    data_fd_ = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    index_fd_ = ::open(index_path.c_str(), O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (data_fd_ < 0 || index_fd_ < 0)
+    {
+        close();
+        throw std::runtime_error("failed to open mask log " + path.string());
+    }
+
+    try
+    {
+        uint64_t index_size = file_size(index_fd_);
+        if (0 == index_size)
+        {
+            const MaskLogIndexHeader header{mask_log_magic, mask_log_version, sparse_image_file_codec_v2};
+            write_all(index_fd_, &header, sizeof(header));
+            index_size = sizeof(header);
+        }
+        else
+        {
+            check_index_header(MappedFile(index_path).data());
+        }
+
+        // A partially written entry from an interrupted append is dropped. The
+        // data file may also have an unreferenced tail; new frames go after it.
+        const uint64_t n_frames = (index_size - sizeof(MaskLogIndexHeader)) / sizeof(MaskLogIndexEntry);
+        if (::ftruncate(index_fd_, sizeof(MaskLogIndexHeader) + n_frames * sizeof(MaskLogIndexEntry)) < 0)
+        {
+            throw std::runtime_error(std::string("failed to truncate mask log index: ") + std::strerror(errno));
+        }
+        n_frames_ = n_frames;
+        data_size_ = file_size(data_fd_);
+    }
+    catch (...)
+    {
+        close();
+        throw;
+    }
+}
+
+MaskLogWriter::~MaskLogWriter()
+{
+    close();
+}
+
+void MaskLogWriter::close()
+{
+    if (data_fd_ >= 0) ::close(data_fd_);
+    if (index_fd_ >= 0) ::close(index_fd_);
+    data_fd_ = -1;
+    index_fd_ = -1;
+}
+
+size_t MaskLogWriter::append(const SparseImage<bool> &image)
+{
+    const std::span<const uint8_t> runs = image.encoded_runs();
+    write_all(data_fd_, runs.data(), runs.size());
+
+    const MaskLogIndexEntry entry{
+        static_cast<uint64_t>(image.width()),
+        static_cast<uint64_t>(image.height()),
+        data_size_,
+        runs.size()};
+    write_all(index_fd_, &entry, sizeof(entry));
+
+    data_size_ += runs.size();
+    return n_frames_++;
+}
+
+void MaskLogWriter::sync()
+{
+    if (::fsync(data_fd_) < 0 || ::fsync(index_fd_) < 0)
+    {
+        throw std::runtime_error(std::string("failed to sync mask log: ") + std::strerror(errno));
+    }
+}
+
+MaskLogReader::MaskLogReader(const std::filesystem::path &path) :
+    path_(path),
+    mutex_(),
+    mapping_()
+{
+    refresh();
+}
+
+std::shared_ptr<const MaskLogReader::Mapping> MaskLogReader::mapping() const
+{
+    std::lock_guard lock(mutex_);
+    return mapping_;
+}
+
+size_t MaskLogReader::size() const
+{
+    return mapping()->entries.size();
+}
+
+size_t MaskLogReader::refresh() const
+{
+    // Map the index before the data, so every entry refers to mapped data.
+    MappedFile index(mask_log_index_path(path_));
+    check_index_header(index.data());
+    const size_t n_frames = (index.data().size() - sizeof(MaskLogIndexHeader)) / sizeof(MaskLogIndexEntry);
+
+    std::lock_guard lock(mutex_);
+    if (mapping_ && mapping_->entries.size() >= n_frames)
+    {
+        return mapping_->entries.size();
+    }
+
+    auto mapping = std::make_shared<Mapping>(Mapping{std::move(index), MappedFile(path_), {}});
+    mapping->entries = std::span(
+        reinterpret_cast<const MaskLogIndexEntry*>(mapping->index.data().data() + sizeof(MaskLogIndexHeader)),
+        n_frames);
+    mapping_ = std::move(mapping);
+    return n_frames;
+}
+
+MaskLogFrame MaskLogReader::frame(size_t n) const
+{
+    std::shared_ptr<const Mapping> mapping = this->mapping();
+    if (n >= mapping->entries.size())
+    {
+        refresh();
+        mapping = this->mapping();
+        if (n >= mapping->entries.size())
+        {
+            throw std::runtime_error("frame number out of range");
+        }
+    }
+
+    const MaskLogIndexEntry &entry = mapping->entries[n];
+    const std::span<const uint8_t> data = mapping->data.data();
+    if (entry.offset > data.size() || entry.size > data.size() - entry.offset)
+    {
+        throw std::runtime_error("mask log frame out of bounds of the data file");
+    }
+
+    SparseImage<bool> image(entry.width, entry.height, data.subspan(entry.offset, entry.size));
+    return {std::move(mapping), std::move(image)};
+}
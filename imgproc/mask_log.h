@@ -0,0 +1,105 @@
+#pragma once
+
+#include "imgproc/sparse_image.h"
+#include "imgproc/sparse_image_file.h"
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <span>
+
+// Append-only log of rle::v2 encoded binary masks, e.g. one per video frame.
+//
+// A log at path is two files. path holds the run streams back to back. path.idx
+// holds a MaskLogIndexHeader followed by one MaskLogIndexEntry per frame, so
+// frame n's entry is at a fixed offset. The writer appends a frame's runs
+// before its index entry, so readers never see an entry whose runs are missing.
+
+struct MaskLogIndexHeader
+{
+    std::array<char, 8> magic;
+    uint32_t version;
+    uint32_t codec;
+};
+static_assert(sizeof(MaskLogIndexHeader) == 16);
+
+struct MaskLogIndexEntry
+{
+    uint64_t width;
+    uint64_t height;
+    uint64_t offset;    // into the data file
+    uint64_t size;      // bytes
+};
+static_assert(sizeof(MaskLogIndexEntry) == 32);
+
+constexpr std::array<char, 8> mask_log_magic{'R', 'L', 'E', 'M', 'L', 'O', 'G', '\0'};
+constexpr uint32_t mask_log_version = 1;
+
+std::filesystem::path mask_log_index_path(const std::filesystem::path &path);
+
+// Appends frames to a new or existing log. Only one writer may be open per log,
+// and append() must not be called concurrently.
+class MaskLogWriter
+{
+  public:
+    explicit MaskLogWriter(const std::filesystem::path &path);
+    ~MaskLogWriter();
+
+    MaskLogWriter(const MaskLogWriter&) = delete;
+    MaskLogWriter& operator=(const MaskLogWriter&) = delete;
+
+    // Returns the frame number.
+    size_t append(const SparseImage<bool> &image);
+
+    size_t size() const { return n_frames_; }
+
+    // Flushes both files to disk.
+    void sync();
+
+  private:
+    void close();
+
+    int data_fd_;
+    int index_fd_;
+    uint64_t data_size_;
+    size_t n_frames_;
+};
+
+// A frame read from a log. Holds on to the mapping that image points into.
+struct MaskLogFrame
+{
+    std::shared_ptr<const void> mapping;
+    SparseImage<bool> image;
+};
+
+// Maps a log for random access. Safe to use from several threads, and while a
+// writer appends to the log. Frames appended after the last refresh() become
+// visible on the next refresh(), which frame() calls when asked for a frame it
+// has not seen yet.
+class MaskLogReader
+{
+  public:
+    explicit MaskLogReader(const std::filesystem::path &path);
+
+    size_t size() const;
+
+    MaskLogFrame frame(size_t n) const;
+
+    // Remaps the log if it has grown. Returns the number of frames.
+    size_t refresh() const;
+
+  private:
+    struct Mapping
+    {
+        MappedFile index;
+        MappedFile data;
+        std::span<const MaskLogIndexEntry> entries;
+    };
+
+    std::shared_ptr<const Mapping> mapping() const;
+
+    std::filesystem::path path_;
+    mutable std::mutex mutex_;
+    mutable std::shared_ptr<const Mapping> mapping_;
+};
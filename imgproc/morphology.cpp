@@ -0,0 +1,302 @@
+#include "imgproc/morphology.h"
+#include "codec/rle_v2.h"
+#include <algorithm>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+using Eigen::Index;
+
+static void check_size(Index width, Index height)
+{
+    if (width <= 0 || height <= 0 || 0 == width % 2 || 0 == height % 2)
+    {
+        throw std::runtime_error("structuring element sizes must be odd and positive");
+    }
+}
+
+StructuringElement StructuringElement::rect(Index width, Index height)
+{
+    check_size(width, height);
+    return {Shape::RECT, width / 2, height / 2};
+}
+
+StructuringElement StructuringElement::cross(Index width, Index height)
+{
+    check_size(width, height);
+    return {Shape::CROSS, width / 2, height / 2};
+}
+
+namespace
+{
+
+struct Interval
+{
+    Index begin;
+    Index end;
+};
+
+// The intervals of ones of every row of an image, sorted and disjoint within
+// each row.
+class RowIntervals
+{
+  public:
+    size_t size() const { return offsets_.size() - 1; }
+
+    std::span<const Interval> row(size_t v) const
+    {
+        return std::span(intervals_).subspan(offsets_[v], offsets_[v + 1] - offsets_[v]);
+    }
+
+    // Adds an interval to the row being built. Intervals need to come in order
+    // of their begin, and ones that touch the last one are merged into it.
+    void push(Interval x)
+    {
+        if (x.begin >= x.end) return;
+
+        if (intervals_.size() > offsets_.back() && x.begin <= intervals_.back().end)
+        {
+            intervals_.back().end = std::max(intervals_.back().end, x.end);
+        }
+        else
+        {
+            intervals_.push_back(x);
+        }
+    }
+
+    void end_row() { offsets_.push_back(intervals_.size()); }
+
+    void push_row(std::span<const Interval> row)
+    {
+        for (const Interval &x : row) push(x);
+        end_row();
+    }
+
+  private:
+    std::vector<size_t> offsets_{0};
+    std::vector<Interval> intervals_;
+};
+
+} // namespace
+
+static RowIntervals ones(const SparseImage<bool> &image)
+{
+    RowIntervals rows;
+    Index v = 0;
+    for (const RowRun &run : image.runs())
+    {
+        for (; v < run.v; ++v) rows.end_row();
+        if (run.value) rows.push({run.u_begin, run.u_end});
+    } // end for
+    for (; v < image.height(); ++v) rows.end_row();
+    return rows;
+}
+
+static RowIntervals complement(const RowIntervals &rows, Index width)
+{
+    RowIntervals out;
+    for (size_t v = 0; v < rows.size(); ++v)
+    {
+        Index u = 0;
+        for (const Interval &x : rows.row(v))
+        {
+            out.push({u, x.begin});
+            u = x.end;
+        } // end for
+        out.push({u, width});
+        out.end_row();
+    } // end for
+    return out;
+}
+
+// Unites two sorted rows into scratch.
+static void unite(std::span<const Interval> a, std::span<const Interval> b, std::vector<Interval> &scratch)
+{
+    scratch.clear();
+    auto push = [&](Interval x) {
+        if (!scratch.empty() && x.begin <= scratch.back().end)
+        {
+            scratch.back().end = std::max(scratch.back().end, x.end);
+        }
+        else
+        {
+            scratch.push_back(x);
+        }
+    };
+
+    size_t i = 0;
+    size_t j = 0;
+    while (i < a.size() || j < b.size())
+    {
+        if (j == b.size() || (i < a.size() && a[i].begin <= b[j].begin)) push(a[i++]);
+        else push(b[j++]);
+    } // end while
+}
+
+// Widens every interval by radius on both sides, clipped to the row.
+static RowIntervals dilate_horizontally(const RowIntervals &rows, Index radius, Index width)
+{
+    RowIntervals out;
+    for (size_t v = 0; v < rows.size(); ++v)
+    {
+        for (const Interval &x : rows.row(v))
+        {
+            out.push({std::max<Index>(0, x.begin - radius), std::min(width, x.end + radius)});
+        } // end for
+        out.end_row();
+    } // end for
+    return out;
+}
+
+// Unites every row with the radius rows above and below it that are within
+// the image.
+//
+// Rows are split into blocks of the window height, and each row keeps the union
+// from the start of its block down to it and from it down to the end of its
+// block. Any window then spans at most two blocks, and is the union of the
+// suffix of its first row and the prefix of its last row, so each row takes
+// three merges whatever the radius.
+static RowIntervals dilate_vertically(const RowIntervals &rows, Index radius)
+{
+    if (0 == radius) return rows;
+
+    const Index height = rows.size();
+    const Index block = 2 * radius + 1;
+    std::vector<Interval> scratch;
+
+    RowIntervals prefix;
+    for (Index v = 0; v < height; ++v)
+    {
+        if (0 == v % block)
+        {
+            prefix.push_row(rows.row(v));
+            continue;
+        }
+        unite(prefix.row(v - 1), rows.row(v), scratch);
+        prefix.push_row(scratch);
+    } // end for
+
+    // Built from the bottom up, so the row of v is height - 1 - v.
+    RowIntervals suffix;
+    for (Index v = height - 1; v >= 0; --v)
+    {
+        if (block - 1 == v % block || height - 1 == v)
+        {
+            suffix.push_row(rows.row(v));
+            continue;
+        }
+        unite(rows.row(v), suffix.row(height - 2 - v), scratch);
+        suffix.push_row(scratch);
+    } // end for
+
+    RowIntervals out;
+    for (Index v = 0; v < height; ++v)
+    {
+        const Index v_first = std::max<Index>(0, v - radius);
+        const Index v_last = std::min<Index>(height - 1, v + radius);
+        if (v_first / block != v_last / block)
+        {
+            unite(suffix.row(height - 1 - v_first), prefix.row(v_last), scratch);
+            out.push_row(scratch);
+        }
+        else if (0 == v_first % block)
+        {
+            out.push_row(prefix.row(v_last));
+        }
+        else
+        {
+            out.push_row(suffix.row(height - 1 - v_first));
+        }
+    } // end for
+    return out;
+}
+
+static RowIntervals dilate_rows(const RowIntervals &rows, const StructuringElement &element, Index width)
+{
+    const RowIntervals wide = dilate_horizontally(rows, element.half_width, width);
+    if (StructuringElement::Shape::RECT == element.shape)
+    {
+        return dilate_vertically(wide, element.half_height);
+    }
+
+    // A cross is the union of its centre row and its centre column.
+    const RowIntervals tall = dilate_vertically(rows, element.half_height);
+    RowIntervals out;
+    std::vector<Interval> scratch;
+    for (size_t v = 0; v < rows.size(); ++v)
+    {
+        unite(wide.row(v), tall.row(v), scratch);
+        out.push_row(scratch);
+    } // end for
+    return out;
+}
+
+// Erosion is the complement of dilating the complement. Since the dilation
+// takes the complement to be zero outside the image, the erosion takes the
+// image to be one there.
+static RowIntervals erode_rows(const RowIntervals &rows, const StructuringElement &element, Index width)
+{
+    return complement(dilate_rows(complement(rows, width), element, width), width);
+}
+
+static SparseImage<bool> to_sparse_image(const RowIntervals &rows, Index width, Index height)
+{
+    std::vector<uint8_t> buff;
+
+    // Ones that continue from the end of a row onto the next are one run.
+    uint64_t zeros_begin = 0;
+    uint64_t ones_begin = 0;
+    uint64_t ones_end = 0;
+    for (size_t v = 0; v < rows.size(); ++v)
+    {
+        const uint64_t row_begin = static_cast<uint64_t>(v) * width;
+        for (const Interval &x : rows.row(v))
+        {
+            if (row_begin + x.begin != ones_end || ones_end == ones_begin)
+            {
+                if (ones_end != ones_begin)
+                {
+                    rle::v2::append_run(buff, ones_begin - zeros_begin);
+                    rle::v2::append_run(buff, ones_end - ones_begin);
+                    zeros_begin = ones_end;
+                }
+                ones_begin = row_begin + x.begin;
+            }
+            ones_end = row_begin + x.end;
+        } // end for
+    } // end for
+
+    if (ones_end != ones_begin)
+    {
+        rle::v2::append_run(buff, ones_begin - zeros_begin);
+        rle::v2::append_run(buff, ones_end - ones_begin);
+        zeros_begin = ones_end;
+    }
+
+    const uint64_t n_pixels = static_cast<uint64_t>(width) * height;
+    if (n_pixels > zeros_begin || buff.empty()) rle::v2::append_run(buff, n_pixels - zeros_begin);
+
+    return SparseImage<bool>(width, height, std::move(buff));
+}
+
+SparseImage<bool> dilate(const SparseImage<bool> &image, const StructuringElement &element)
+{
+    return to_sparse_image(dilate_rows(ones(image), element, image.width()), image.width(), image.height());
+}
+
+SparseImage<bool> erode(const SparseImage<bool> &image, const StructuringElement &element)
+{
+    return to_sparse_image(erode_rows(ones(image), element, image.width()), image.width(), image.height());
+}
+
+SparseImage<bool> opening(const SparseImage<bool> &image, const StructuringElement &element)
+{
+    const RowIntervals eroded = erode_rows(ones(image), element, image.width());
+    return to_sparse_image(dilate_rows(eroded, element, image.width()), image.width(), image.height());
+}
+
+SparseImage<bool> closing(const SparseImage<bool> &image, const StructuringElement &element)
+{
+    const RowIntervals dilated = dilate_rows(ones(image), element, image.width());
+    return to_sparse_image(erode_rows(dilated, element, image.width()), image.width(), image.height());
+}
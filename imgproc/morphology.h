@@ -0,0 +1,40 @@
+#pragma once
+
+#include "imgproc/sparse_image.h"
+#include <Eigen/Dense>
+
+// Structuring element centred on the pixel it is applied to.
+struct StructuringElement
+{
+    enum class Shape
+    {
+        RECT,  // every pixel of the rectangle
+        CROSS, // the centre row and the centre column of the rectangle
+    };
+
+    Shape shape;
+    Eigen::Index half_width;
+    Eigen::Index half_height;
+
+    // width and height are the odd, full sizes of the bounding rectangle.
+    static StructuringElement rect(Eigen::Index width, Eigen::Index height);
+    static StructuringElement cross(Eigen::Index width, Eigen::Index height);
+};
+
+// Binary morphology computed on the runs of the image, without decoding it.
+// Each row is turned into a list of intervals of ones, which are widened along
+// the row and then united over a sliding window of rows, so the work grows
+// with the number of runs rather than the number of pixels.
+//
+// The border is neutral, as by default in OpenCV. Pixels outside the image
+// count as zeros for dilation and as ones for erosion, so neither sets or
+// clears pixels only because they are near the border. opening() never adds
+// pixels and closing() never removes any.
+SparseImage<bool> dilate(const SparseImage<bool> &image, const StructuringElement &element);
+SparseImage<bool> erode(const SparseImage<bool> &image, const StructuringElement &element);
+
+// erode() then dilate()
+SparseImage<bool> opening(const SparseImage<bool> &image, const StructuringElement &element);
+
+// dilate() then erode()
+SparseImage<bool> closing(const SparseImage<bool> &image, const StructuringElement &element);
@@ -16,6 +16,19 @@ namespace binary::boolean
         template <typename T>
         auto operator()(T a, T b) const { return a || b; }
     };
+
+    struct Xor
+    {
+        template <typename T>
+        auto operator()(T a, T b) const { return a != b; }
+    };
+
+    // a and not b
+    struct AndNot
+    {
+        template <typename T>
+        auto operator()(T a, T b) const { return a && !b; }
+    };
 } // binary::boolean
 
 namespace binary::arithmetic
@@ -66,6 +79,57 @@ namespace unary::arithmetic
     };
 } // unary::arithmetic
 
+namespace unary::predicate
+{
+    // Predicates apply both to scalars and to Eigen array expressions.
+    template <typename T>
+    struct Greater
+    {
+        T threshold;
+
+        template <typename X>
+        auto operator()(const X& x) const { return x > threshold; }
+    };
+
+    template <typename T>
+    struct GreaterEqual
+    {
+        T threshold;
+
+        template <typename X>
+        auto operator()(const X& x) const { return x >= threshold; }
+    };
+
+    template <typename T>
+    struct Less
+    {
+        T threshold;
+
+        template <typename X>
+        auto operator()(const X& x) const { return x < threshold; }
+    };
+
+    template <typename T>
+    struct LessEqual
+    {
+        T threshold;
+
+        template <typename X>
+        auto operator()(const X& x) const { return x <= threshold; }
+    };
+
+    // lo <= x < hi
+    template <typename T>
+    struct InRange
+    {
+        T lo;
+        T hi;
+
+        template <typename X>
+        auto operator()(const X& x) const { return (x >= lo) && (x < hi); }
+    };
+} // unary::predicate
+
 namespace iterated_binary
 {
     template <typename Op>
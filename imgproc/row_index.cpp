@@ -0,0 +1,91 @@
+#include "imgproc/row_index.h"
+#include "codec/leb128.h"
+#include <stdexcept>
+
+RowIndex::RowIndex(std::span<const uint8_t> encoded_runs, Eigen::Index width, Eigen::Index height, Eigen::Index stride) :
+    stride_(stride),
+    owned_entries_(),
+    entries_()
+{
+    if (stride <= 0)
+    {
+        throw std::runtime_error("row index stride must be positive");
+    }
+
+    const size_t n_entries = (height + stride - 1) / stride;
+    const uint64_t entry_pixels = static_cast<uint64_t>(width) * stride;
+    owned_entries_.reserve(n_entries);
+
+    const uint8_t *const rle_begin = encoded_runs.data();
+    const uint8_t *rle_it = rle_begin;
+    const uint8_t *const rle_end = rle_begin + encoded_runs.size();
+
+    uint64_t pixel = 0;
+    bool value = false;
+    while (owned_entries_.size() < n_entries && rle_end > rle_it)
+    {
+        const uint64_t offset = rle_it - rle_begin;
+        const uint32_t run_length = codec::leb128::decode_u32(rle_it, rle_end);
+
+        // Every entry whose first pixel falls within this run points at it.
+        while (owned_entries_.size() < n_entries && owned_entries_.size() * entry_pixels < pixel + run_length)
+        {
+            owned_entries_.push_back({offset, pixel, value, 0});
+        }
+
+        pixel += run_length;
+        value = !value;
+    } // end while
+
+    // The rest of the image is the padding after the end of the stream.
+    while (owned_entries_.size() < n_entries)
+    {
+        owned_entries_.push_back({encoded_runs.size(), pixel, value, 0});
+    }
+
+    entries_ = owned_entries_;
+}
+
+RowIndex::RowIndex(std::span<const SeekPoint> entries, Eigen::Index stride) :
+    stride_(stride),
+    owned_entries_(),
+    entries_(entries)
+{
+    if (stride <= 0)
+    {
+        throw std::runtime_error("row index stride must be positive");
+    }
+}
+
+RowIndex::RowIndex(RowIndex &&other) noexcept :
+    stride_(other.stride_),
+    owned_entries_(std::move(other.owned_entries_)),
+    entries_(other.entries_)
+{
+}
+
+RowIndex& RowIndex::operator=(RowIndex &&other) noexcept
+{
+    stride_ = other.stride_;
+    owned_entries_ = std::move(other.owned_entries_);
+    entries_ = other.entries_;
+    return *this;
+}
+
+RowIndex::RowIndex(const RowIndex &other) :
+    stride_(other.stride_),
+    owned_entries_(other.owned_entries_),
+    entries_(other.owned_entries_.empty() ? other.entries_ : std::span<const SeekPoint>(owned_entries_))
+{
+}
+
+RowIndex& RowIndex::operator=(const RowIndex &other)
+{
+    if (this != &other)
+    {
+        stride_ = other.stride_;
+        owned_entries_ = other.owned_entries_;
+        entries_ = other.owned_entries_.empty() ? other.entries_ : std::span<const SeekPoint>(owned_entries_);
+    }
+    return *this;
+}
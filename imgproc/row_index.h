@@ -0,0 +1,46 @@
+#pragma once
+
+#include <Eigen/Dense>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Position in a v2 run stream: the run that starts at byte offset and covers
+// pixel index pixel onwards, and its value.
+struct SeekPoint
+{
+    uint64_t offset;
+    uint64_t pixel;
+    uint32_t value;
+    uint32_t reserved;
+};
+static_assert(sizeof(SeekPoint) == 24);
+
+// Seek points at the first pixel of every stride-th row of an image, so that
+// decoding can start at any row after skipping fewer than stride rows.
+class RowIndex
+{
+  public:
+    // Builds the index in one pass over the encoded runs.
+    RowIndex(std::span<const uint8_t> encoded_runs, Eigen::Index width, Eigen::Index height, Eigen::Index stride = 16);
+
+    // Wraps entries stored elsewhere, e.g. in a mapped file, without copying.
+    RowIndex(std::span<const SeekPoint> entries, Eigen::Index stride);
+
+    RowIndex(RowIndex &&other) noexcept;
+    RowIndex& operator=(RowIndex &&other) noexcept;
+    RowIndex(const RowIndex &other);
+    RowIndex& operator=(const RowIndex &other);
+
+    Eigen::Index stride() const { return stride_; }
+    std::span<const SeekPoint> entries() const { return entries_; }
+
+    // The last seek point at or before the first pixel of row v.
+    const SeekPoint& seek(Eigen::Index v) const { return entries_[v / stride_]; }
+
+  private:
+    Eigen::Index stride_;
+    std::vector<SeekPoint> owned_entries_;
+    std::span<const SeekPoint> entries_;
+};
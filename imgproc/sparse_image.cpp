@@ -7,8 +7,8 @@ SparseImage<bool>::SparseImage(const Eigen::Array<bool, Eigen::Dynamic, Eigen::D
     height_(array.rows()),
     encoded_runs_()
 {
-    // TODO: Count the runs and allocate the right amount of memory.
-    owned_buff_.resize(10e6);
+    const std::span<const uint8_t> data(reinterpret_cast<const uint8_t*>(array.data()), array.size());
 
-    encoded_runs_ = rle::v2::encode(std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(array.data()), array.size()), owned_buff_);
+    owned_buff_.resize(rle::v2::encoded_size(data));
+    encoded_runs_ = rle::v2::encode(data, owned_buff_);
 }
\ No newline at end of file
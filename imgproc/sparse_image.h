@@ -2,10 +2,21 @@
 
 #include "codec/leb128.h"
 #include "codec/rle_v2.h"
+#include "codec/thread_pool.h"
 #include "imgproc/common.h"
+#include "imgproc/row_index.h"
 #include <Eigen/Dense>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
 #include <concepts>
 #include <iterator>
+#include <limits>
+#include <optional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 inline std::tuple<bool, uint32_t, std::span<const uint8_t>> decode_run(std::span<const uint8_t> buff, bool prev_value)
 {
@@ -80,6 +91,125 @@ class PixelIterator
 };
 
 
+// Pixels [u_begin, u_end) of row v, which all have the same value.
+struct RowRun
+{
+    Eigen::Index v;
+    Eigen::Index u_begin;
+    Eigen::Index u_end;
+    bool value;
+};
+
+// Iterates over the runs of a v2 stream, including the runs of zeros, with runs
+// that span several rows split at the row boundaries. Like rle::v2::decode, a
+// stream that ends early is padded with a run of the value that would follow;
+// runs past the end of the image are ignored.
+class RunIterator
+{
+  public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = RowRun;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const RowRun*;
+    using reference = const RowRun&;
+
+    RunIterator(std::span<const uint8_t> encoded_runs, Eigen::Index width, Eigen::Index height) :
+        RunIterator(encoded_runs, width, 0, height, SeekPoint{})
+    {
+    }
+
+    // Iterates over rows [v_begin, v_end), starting the decode at seek_point,
+    // which needs to be at or before the first pixel of row v_begin.
+    RunIterator(
+        std::span<const uint8_t> encoded_runs,
+        Eigen::Index width,
+        Eigen::Index v_begin,
+        Eigen::Index v_end,
+        const SeekPoint &seek_point) :
+        rle_it_(encoded_runs.data() + seek_point.offset),
+        rle_end_(encoded_runs.data() + encoded_runs.size()),
+        width_(width),
+        height_(v_end),
+        run_{v_begin, 0, 0, !seek_point.value},
+        remaining_()
+    {
+        if (0 == width_ || v_begin >= v_end)
+        {
+            run_ = end_run();
+            return;
+        }
+
+        // Skip to the first pixel of row v_begin
+        size_t skip = v_begin * width_ - seek_point.pixel;
+        while (true)
+        {
+            while (0 == remaining_) next_run();
+            if (skip < remaining_) break;
+            skip -= remaining_;
+            remaining_ = 0;
+        }
+        remaining_ -= skip;
+
+        ++(*this);
+    }
+
+    // End iterator
+    RunIterator() :
+        rle_it_(),
+        rle_end_(),
+        width_(),
+        height_(),
+        run_(end_run()),
+        remaining_() {}
+
+    RunIterator& operator++()
+    {
+        if (run_.u_end == width_)
+        {
+            ++run_.v;
+            run_.u_end = 0;
+        }
+        if (run_.v >= height_)
+        {
+            run_ = end_run();
+            return *this;
+        }
+
+        while (0 == remaining_) next_run();
+
+        const size_t n_px = std::min<size_t>(remaining_, width_ - run_.u_end);
+        run_.u_begin = run_.u_end;
+        run_.u_end += n_px;
+        remaining_ -= n_px;
+
+        return *this;
+    }
+
+    void operator++(int) { ++(*this); }
+
+    bool operator==(const RunIterator& rhs) const { return run_.v == rhs.run_.v && run_.u_end == rhs.run_.u_end; }
+    bool operator!=(const RunIterator& rhs) const { return !(*this == rhs); }
+    const RowRun& operator*() const { return run_; }
+    const RowRun* operator->() const { return &run_; }
+
+  private:
+    static constexpr RowRun end_run() { return {-1, 0, 0, false}; }
+
+    // Once the stream is exhausted, the padding run lasts until the end.
+    void next_run()
+    {
+        remaining_ = rle_end_ > rle_it_ ? codec::leb128::decode_u32(rle_it_, rle_end_) : std::numeric_limits<size_t>::max();
+        run_.value = !run_.value;
+    }
+
+    const uint8_t *rle_it_;
+    const uint8_t *rle_end_;
+    Eigen::Index width_;
+    Eigen::Index height_;
+    RowRun run_;
+    size_t remaining_;
+};
+
 template <typename T>
 requires std::is_arithmetic_v<T>
 bool init_prev_value(); 
@@ -94,15 +224,57 @@ class SparseImage
   public:
     using value_type = T;
 
-    SparseImage(Eigen::Index width, Eigen::Index height, std::span<uint8_t> encoded_runs) :
+    SparseImage(Eigen::Index width, Eigen::Index height, std::span<const uint8_t> encoded_runs) :
         width_(width),
         height_(height),
         encoded_runs_(encoded_runs) 
     {
     }
 
+    SparseImage(Eigen::Index width, Eigen::Index height, std::vector<uint8_t> &&encoded_runs) :
+        encoded_runs_(),
+        width_(width),
+        height_(height),
+        owned_buff_(std::move(encoded_runs))
+    {
+        encoded_runs_ = owned_buff_;
+    }
+
     SparseImage(const Eigen::Array<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> &array);
 
+    // A copy of an image that owns its runs points at its own copy of them.
+    // Moving keeps the heap block of the runs, so the span stays valid.
+    SparseImage(const SparseImage &other) :
+        encoded_runs_(other.encoded_runs_),
+        width_(other.width_),
+        height_(other.height_),
+        owned_buff_(other.owned_buff_),
+        row_index_(other.row_index_)
+    {
+        if (!owned_buff_.empty())
+        {
+            encoded_runs_ = std::span<const uint8_t>(owned_buff_.data(), other.encoded_runs_.size());
+        }
+    }
+
+    SparseImage& operator=(const SparseImage &other)
+    {
+        if (this != &other)
+        {
+            width_ = other.width_;
+            height_ = other.height_;
+            owned_buff_ = other.owned_buff_;
+            row_index_ = other.row_index_;
+            encoded_runs_ = owned_buff_.empty()
+                ? other.encoded_runs_
+                : std::span<const uint8_t>(owned_buff_.data(), other.encoded_runs_.size());
+        }
+        return *this;
+    }
+
+    SparseImage(SparseImage &&other) noexcept = default;
+    SparseImage& operator=(SparseImage &&other) noexcept = default;
+
     PixelIterator<T> begin() const
     {
         return PixelIterator(init_prev_value<bool>(), 0, size(), encoded_runs_);
@@ -117,6 +289,45 @@ class SparseImage
     Eigen::Index height() const { return height_; }
     Eigen::Index size() const { return width_ * height_; }
 
+    std::span<const uint8_t> encoded_runs() const { return encoded_runs_; }
+
+    rle::v2::Stats stats() const { return rle::v2::stats(encoded_runs_); }
+
+    RunIterator run_begin() const { return RunIterator(encoded_runs_, width_, height_); }
+    RunIterator run_end() const { return RunIterator(); }
+    std::ranges::subrange<RunIterator> runs() const { return {run_begin(), run_end()}; }
+
+    // Random access through a RowIndex. Unless build_row_index() or
+    // set_row_index() was called first, the index is built on first use, which
+    // is not safe to race with other threads.
+    RunIterator row_begin(Eigen::Index v) const { return RunIterator(encoded_runs_, width_, v, height_, row_index().seek(v)); }
+    std::ranges::subrange<RunIterator> runs(Eigen::Index v_begin, Eigen::Index v_end) const
+    {
+        return {RunIterator(encoded_runs_, width_, v_begin, v_end, row_index().seek(v_begin)), run_end()};
+    }
+
+    bool at(Eigen::Index u, Eigen::Index v) const
+    {
+        for (const RowRun &run : runs(v, v + 1))
+        {
+            if (u < run.u_end) return run.value;
+        }
+        return false;
+    }
+
+    void build_row_index(Eigen::Index stride = 16) { row_index_.emplace(encoded_runs_, width_, height_, stride); }
+    void set_row_index(RowIndex row_index) { row_index_.emplace(std::move(row_index)); }
+    bool has_row_index() const { return row_index_.has_value(); }
+
+    const RowIndex& row_index() const
+    {
+        if (!row_index_)
+        {
+            row_index_.emplace(encoded_runs_, width_, height_);
+        }
+        return *row_index_;
+    }
+
     Eigen::Index rows() const { return height_; }
     Eigen::Index cols() const { return width_; }
 
@@ -124,63 +335,473 @@ class SparseImage
     Eigen::Index v(const PixelIterator<T> &it) const { return it.index() / width_; }
 
   private:
-    std::span<uint8_t> encoded_runs_;
+    std::span<const uint8_t> encoded_runs_;
     Eigen::Index width_;
     Eigen::Index height_;
     std::vector<uint8_t> owned_buff_;
+    mutable std::optional<RowIndex> row_index_;
 };
 
-inline void visit_sparse_image(
-    const SparseImage<bool>& image,
-    std::function<void(Eigen::Index, Eigen::Index, bool)> visitor)
+// Builds a binary SparseImage from pred(x) in a single pass, without a
+// full-size mask in between. pred is evaluated on a few rows of x at a time and
+// must return a boolean Eigen array expression, e.g.
+// ops::unary::predicate::Greater<float>{0.5f}.
+template <typename Derived, typename Pred>
+SparseImage<bool> make_sparse_image(const Eigen::ArrayBase<Derived> &x, Pred pred)
+{
+    using Eigen::Index;
+
+    // Keep the mask of a block in L1
+    constexpr Index block_size = 16384;
+    const Index block_rows = std::max<Index>(1, block_size / std::max<Index>(1, x.cols()));
+
+    ImArray<bool> mask(std::min(block_rows, x.rows()), x.cols());
+    std::vector<uint8_t> buff;
+    size_t buff_size = 0;
+    rle::v2::Encoder encoder;
+
+    for (Index row = 0; row < x.rows(); row += block_rows)
+    {
+        const Index n_rows = std::min(block_rows, x.rows() - row);
+        mask.topRows(n_rows) = pred(x.middleRows(row, n_rows));
+
+        const std::span<const uint8_t> data(reinterpret_cast<const uint8_t*>(mask.data()), n_rows * x.cols());
+        buff.resize(buff_size + rle::v2::max_encoded_size(data.size()) + 4);
+        buff_size += encoder.push(data, std::span(buff).subspan(buff_size)).size();
+    } // end for row
+
+    buff.resize(buff_size + 5);
+    buff_size += encoder.finish(std::span(buff).subspan(buff_size)).size();
+    buff.resize(buff_size);
+
+    return SparseImage<bool>(x.cols(), x.rows(), std::move(buff));
+}
+
+// Combines two binary images of the same size pixel by pixel with op, e.g.
+// ops::binary::boolean::And, without decoding either of them. The run streams
+// are merged directly, so the cost is linear in the number of runs of lhs and
+// rhs rather than in the number of pixels.
+template <typename Op>
+SparseImage<bool> combine(const SparseImage<bool> &lhs, const SparseImage<bool> &rhs, Op op)
+{
+    assert(lhs.width() == rhs.width());
+    assert(lhs.height() == rhs.height());
+
+    // Runs alternate starting with zeros. Like decode(), an exhausted stream
+    // carries on with an endless run of the other value.
+    struct Stream
+    {
+        const uint8_t *it;
+        const uint8_t *end;
+        bool value;
+        uint64_t remaining;
+
+        void next()
+        {
+            value = !value;
+            remaining = it < end ? codec::leb128::decode_u32(it, end) : std::numeric_limits<uint64_t>::max();
+        }
+    };
+
+    const std::span<const uint8_t> lhs_runs = lhs.encoded_runs();
+    const std::span<const uint8_t> rhs_runs = rhs.encoded_runs();
+    Stream a{lhs_runs.data(), lhs_runs.data() + lhs_runs.size(), true, 0};
+    Stream b{rhs_runs.data(), rhs_runs.data() + rhs_runs.size(), true, 0};
+
+    // The merged stream has no more runs than the inputs together, so their
+    // size is a good first guess at its size.
+    std::vector<uint8_t> buff;
+    buff.reserve(lhs_runs.size() + rhs_runs.size() + 5);
+
+    const uint64_t n_pixels = static_cast<uint64_t>(lhs.width()) * static_cast<uint64_t>(lhs.height());
+    bool value = false;
+    uint64_t run_length = 0;
+    for (uint64_t n_done = 0; n_done < n_pixels;)
+    {
+        while (0 == a.remaining) a.next();
+        while (0 == b.remaining) b.next();
+
+        const uint64_t n = std::min({a.remaining, b.remaining, n_pixels - n_done});
+        const bool next_value = static_cast<bool>(op(a.value, b.value));
+        if (next_value != value)
+        {
+            rle::v2::append_run(buff, run_length);
+            value = next_value;
+            run_length = 0;
+        }
+
+        run_length += n;
+        a.remaining -= n;
+        b.remaining -= n;
+        n_done += n;
+    } // end for
+    rle::v2::append_run(buff, run_length);
+
+    return SparseImage<bool>(lhs.width(), lhs.height(), std::move(buff));
+}
+
+// Visitors are taken as template parameters so that they can be inlined into
+// the loops over runs.
+template <typename F>
+concept PixelVisitor = std::invocable<F&, Eigen::Index, Eigen::Index, bool>;
+
+template <typename F>
+concept RunVisitor = std::invocable<F&, Eigen::Index, Eigen::Index, Eigen::Index, bool>;
+
+// Calls f(v, u_begin, u_end, value) for each run of image, split at rows. Runs
+// of zeros are visited too.
+template <RunVisitor F>
+void visit_runs(const SparseImage<bool>& image, F &&f)
+{
+    for (const RowRun &run : image.runs())
+    {
+        f(run.v, run.u_begin, run.u_end, run.value);
+    }
+}
+
+// Calls visitor(u, v, true) for each set pixel of image.
+template <PixelVisitor F>
+void visit_sparse_image(const SparseImage<bool>& image, F &&visitor)
+{
+    for (const RowRun &run : image.runs())
+    {
+        if (!run.value) continue;
+
+        for (Eigen::Index u = run.u_begin; u < run.u_end; ++u)
+        {
+            visitor(u, run.v, true);
+        }
+    }
+}
+
+// Decodes the region of image with its top left corner at (u0, v0) and the size
+// of out into out. Every pixel of out is written, one run at a time. Decoding
+// starts from the image's row index, which is built if there is none.
+template <typename T=float>
+requires std::is_arithmetic_v<T>
+void from_sparse_image(const SparseImage<T>& image, Eigen::Index u0, Eigen::Index v0, ImArrayRef<T> out)
 {
-    for (auto it = image.begin(); it != image.end(); ++it)
+    using Eigen::Index;
+
+    assert(u0 >= 0 && u0 + out.cols() <= image.width());
+    assert(v0 >= 0 && v0 + out.rows() <= image.height());
+
+    const Index u1 = u0 + out.cols();
+    const Index v1 = v0 + out.rows();
+
+    for (const RowRun &run : 0 == v0 ? image.runs() : image.runs(v0, v1))
     {
-        const auto u = image.u(it);
-        const auto v = image.v(it);
-        const auto val = *it;
-        visitor(u, v, val);
+        if (run.v >= v1) break;
+
+        const Index u_begin = std::max(run.u_begin, u0);
+        const Index u_end = std::min(run.u_end, u1);
+        if (u_begin < u_end)
+        {
+            std::fill_n(&out(run.v - v0, u_begin - u0), u_end - u_begin, static_cast<T>(run.value));
+        }
     }
 }
 
+// Decodes the whole of image into out, which needs to be the same size.
 template <typename T=float>
 requires std::is_arithmetic_v<T>
 void from_sparse_image(const SparseImage<T>& image, ImArrayRef<T> out)
 {
-    visit_sparse_image(image, [&out](Eigen::Index u, Eigen::Index v, T val) {
-        out(v, u) = val;
-    });
+    assert(out.rows() == image.height());
+    assert(out.cols() == image.width());
+
+    // Byte images without padding between rows are exactly what the codec
+    // decodes to.
+    if constexpr (sizeof(T) == 1)
+    {
+        if (out.outerStride() == out.cols())
+        {
+            rle::v2::decode(image.encoded_runs(), std::span(reinterpret_cast<uint8_t*>(out.data()), out.size()));
+            return;
+        }
+    }
+
+    from_sparse_image<T>(image, 0, 0, out);
 }
 
+
+// Shape of a correlation kernel, which picks how correlate() spreads runs.
+enum class KernelKind
+{
+    GENERAL,
+    SEPARABLE, // outer product of a column and a row
+    BOX,       // every coefficient is the same
+};
+
+template <typename T=float>
+requires std::is_arithmetic_v<T>
+KernelKind classify_kernel(const ImArrayConstRef<T> &kernel)
+{
+    using Eigen::Index;
+
+    if ((kernel == kernel(0, 0)).all()) return KernelKind::BOX;
+
+    // A rank one kernel is the outer product of the column and the row through
+    // its largest coefficient. The factors have to reproduce every coefficient
+    // to within a few ulps of T, and exactly for integer kernels, so that the
+    // separable path never stands in for a merely close kernel.
+    const ImArray<double> k = kernel.template cast<double>();
+    Index v0 = 0;
+    Index u0 = 0;
+    const double magnitude = k.abs().maxCoeff(&v0, &u0);
+    const double pivot = k(v0, u0);
+    const double tolerance = 8 * static_cast<double>(std::numeric_limits<T>::epsilon()) * magnitude * magnitude;
+
+    for (Index v = 0; v < k.rows(); ++v)
+    for (Index u = 0; u < k.cols(); ++u)
+    {
+        if (std::abs(k(v, u) * pivot - k(v, u0) * k(v0, u)) > tolerance) return KernelKind::GENERAL;
+    }
+
+    return KernelKind::SEPARABLE;
+}
+
+// Correlates image with kernel into rows [v_begin, v_end) of out, which is the
+// same size as image, leaving every other row of out untouched. Each set pixel
+// at (u, v) adds kernel centred on (u, v) to out, clipped at the borders. Only
+// the input rows within half a kernel of [v_begin, v_end) are decoded.
+//
+// A run of ones [a, b) adds coefficient k(i, j) to the columns
+// [a + j - kw / 2, b + j - kw / 2) of its output row, which is two updates of a
+// difference row whatever the length of the run. Box kernels need four updates
+// of a second difference row per run, shared by all output rows.
+//
+// Separable kernels are not always applied as two 1D passes. The vertical pass
+// touches all kh * width pixels the row reaches, which costs more than the
+// 2 * kw * kh difference updates per run of the general path on rows with few
+// runs. Each input row takes whichever of the two is cheaper. A row with many
+// runs is spread along the row with the kernel's row factor, then added to each
+// output row scaled by its column factor. A row with few runs takes the general
+// path. Both give the same sums.
+//
+// Sums are kept in double for floating point and in int64_t for integer T, and
+// converted to T once per output pixel.
+//
+// Input rows below the top of the image are found through row_index, or through
+// the image's own row index, built on first use, when row_index is null.
 template <typename T=float>
 requires std::is_arithmetic_v<T>
-void correlate(const SparseImage<bool>& image, const ImArrayRef<T> &kernel, ImArrayRef<T> out)
+void correlate_rows(const SparseImage<bool>& image, const ImArrayConstRef<T> &kernel, KernelKind kind,
+                    Eigen::Index v_begin, Eigen::Index v_end, ImArrayRef<T> out,
+                    const RowIndex *row_index = nullptr)
 {
     using Eigen::Index;
-    using Eigen::Vector;
+    using Acc = std::conditional_t<std::is_floating_point_v<T>, double, int64_t>;
 
     assert(kernel.cols() % 2 == 1);
     assert(kernel.rows() % 2 == 1);
+    assert(out.cols() == image.width());
+    assert(out.rows() == image.height());
+    assert(0 <= v_begin && v_begin <= v_end && v_end <= out.rows());
+
+    if (v_begin == v_end) return;
+
+    const Index width = out.cols();
+    const Index height = out.rows();
+    const Index kh = kernel.rows();
+    const Index kw = kernel.cols();
+    const Index hv = kh / 2;
+    const Index hu = kw / 2;
+
+    // Difference rows are padded by a kernel width on both sides so that runs
+    // at the borders need no clipping.
+    const Index pad = kw;
+    const Index padded_width = width + 2 * kw + 1;
+
+    // Output row v is complete once input row v + hv has been spread, and no
+    // input row reaches further than kh rows below that.
+    const Index n_ring = kh + 1;
+    ImArray<Acc> diffs = ImArray<Acc>::Zero(n_ring, padded_width);
+    auto ring_index = [&](Index v) { return (v - v_begin + n_ring) % n_ring; };
+    auto ring_row = [&](Index v) { return &diffs(ring_index(v), pad); };
+
+    // kernel(i, j) == column[i] * row[j] for separable kernels.
+    std::vector<double> column;
+    std::vector<double> row;
+    std::vector<double> row_spread;
+    ImArray<double> dense;
+    if (KernelKind::SEPARABLE == kind)
+    {
+        Index v0 = 0;
+        Index u0 = 0;
+        kernel.template cast<double>().abs().maxCoeff(&v0, &u0);
+        for (Index i = 0; i < kh; ++i) column.push_back(static_cast<double>(kernel(i, u0)));
+        for (Index j = 0; j < kw; ++j) row.push_back(static_cast<double>(kernel(v0, j)) / static_cast<double>(kernel(v0, u0)));
+        row_spread.resize(padded_width);
+        dense = ImArray<double>::Zero(n_ring, width);
+    }
 
-    const Vector<Index, 2> img_size(out.cols(), out.rows());
-    const Vector<Index, 2> kernel_size(kernel.cols(), kernel.rows());
-    const Vector<Index, 2> half_kernel_size = kernel_size / 2;
+    std::vector<Acc> box_sum(KernelKind::BOX == kind ? padded_width : 0);
+    auto add_box = [&](Acc *diff, Index a, Index b, Acc c) {
+        diff[a - hu] += c;
+        diff[a - hu + kw] -= c;
+        diff[b - hu] -= c;
+        diff[b - hu + kw] += c;
+    };
+
+    auto to_acc = [](double x) -> Acc {
+        if constexpr (std::is_floating_point_v<T>) return x;
+        else return std::llround(x);
+    };
+
+    const Index v_first = v_begin + hv - kh + 1;
+    const Index v_last = v_end + hv;
+    std::ranges::subrange<RunIterator> runs = image.runs();
+    if (v_first > 0)
+    {
+        const Index v_end_in = std::min(v_last, height);
+        runs = row_index
+            ? std::ranges::subrange<RunIterator>(
+                RunIterator(image.encoded_runs(), width, v_first, v_end_in, row_index->seek(v_first)), RunIterator())
+            : image.runs(v_first, v_end_in);
+    }
+    auto it = runs.begin();
+    const auto end = runs.end();
 
-    visit_sparse_image(image, [&](Eigen::Index u, Eigen::Index v, bool val) {
-        // UV coordinates in the input image
-        const Vector<Index, 2> uv_img(u, v);
+    std::vector<std::pair<Index, Index>> ones;
+    for (Index v_in = v_first; v_in < v_last; ++v_in)
+    {
+        ones.clear();
+        for (; v_in >= 0 && it != end && it->v == v_in; ++it)
+        {
+            if (it->value) ones.emplace_back(it->u_begin, it->u_end);
+        } // end for
 
-        // Min and max UV coordinates in the kernel
-        const Vector<Index, 2> min_uv_kernel = (half_kernel_size - uv_img).cwiseMax(Vector<Index, 2>::Zero());
-        const Vector<Index, 2> max_uv_kernel = (kernel_size + (img_size - uv_img)).cwiseMin(kernel_size - Vector<Index, 2>::Ones());
+        // The first output row input row v_in reaches, which it also completes.
+        const Index v_out = v_in - hv;
+        const Index i_begin = std::max<Index>(0, v_begin - v_out);
+        const Index i_end = std::min<Index>(kh, v_end - v_out);
 
-        for (Index v_kernel = min_uv_kernel(1); v_kernel <= max_uv_kernel(1); ++v_kernel)
-        for (Index u_kernel = min_uv_kernel(0); u_kernel <= max_uv_kernel(0); ++u_kernel)
+        // Two 1D passes for separable kernels on rows where they are cheaper.
+        const Index n_ones = static_cast<Index>(ones.size());
+        const bool spread_row = KernelKind::SEPARABLE == kind && 2 * n_ones * kw * kh > 2 * n_ones * kw + width * kh;
+
+        if (KernelKind::BOX == kind)
         {
-            const Vector<Index, 2> uv_kernel(u_kernel, v_kernel);
-            const Vector<Index, 2> uv_out = uv_kernel + uv_img - half_kernel_size;
+            const Acc c = static_cast<Acc>(kernel(0, 0));
+            for (const auto &[a, b] : ones)
+            {
+                add_box(ring_row(v_out), a, b, c);
+                add_box(ring_row(v_out + kh), a, b, -c);
+            } // end for
+        }
+        else if (spread_row)
+        {
+            std::fill(row_spread.begin(), row_spread.end(), 0.0);
+            for (const auto &[a, b] : ones)
+            for (Index j = 0; j < kw; ++j)
+            {
+                row_spread[pad + a + j - hu] += row[j];
+                row_spread[pad + b + j - hu] -= row[j];
+            } // end for
+
+            double sum = 0.0;
+            for (Index k = 0; k < pad + width; ++k)
+            {
+                sum += row_spread[k];
+                row_spread[k] = sum;
+            } // end for
+
+            const Eigen::Map<const Eigen::Array<double, 1, Eigen::Dynamic>> spread(&row_spread[pad], width);
+            for (Index i = i_begin; i < i_end; ++i)
+            {
+                dense.row(ring_index(v_out + i)) += column[i] * spread;
+            } // end for
+        }
+        else
+        {
+            for (Index i = i_begin; i < i_end; ++i)
+            {
+                Acc *diff = ring_row(v_out + i);
+                for (Index j = 0; j < kw; ++j)
+                {
+                    const Acc c = static_cast<Acc>(kernel(i, j));
+                    if (0 == c) continue;
+
+                    for (const auto &[a, b] : ones)
+                    {
+                        diff[a + j - hu] += c;
+                        diff[b + j - hu] -= c;
+                    } // end for
+                } // end for
+            } // end for
+        }
 
-            out(uv_out(1), uv_out(0)) += val * kernel(uv_kernel(1), uv_kernel(0));
+        // Output row v_out has all of its contributions.
+        Acc *diff = ring_row(v_out) - pad;
+        const bool emit = v_out >= v_begin;
+        if (KernelKind::BOX == kind)
+        {
+            for (Index k = 0; k < padded_width; ++k) box_sum[k] += diff[k];
+
+            Acc slope = 0;
+            Acc value = 0;
+            for (Index k = 0; emit && k < pad + width; ++k)
+            {
+                slope += box_sum[k];
+                value += slope;
+                if (k >= pad) out(v_out, k - pad) += static_cast<T>(value);
+            } // end for
         }
+        else if (emit)
+        {
+            Acc value = 0;
+            for (Index k = 0; k < pad; ++k) value += diff[k];
+            for (Index u = 0; u < width; ++u)
+            {
+                value += diff[pad + u];
+                const Acc spread_value = KernelKind::SEPARABLE == kind ? to_acc(dense(ring_index(v_out), u)) : 0;
+                out(v_out, u) += static_cast<T>(value + spread_value);
+            } // end for
+        }
+
+        std::fill(diff, diff + padded_width, 0);
+        if (KernelKind::SEPARABLE == kind) dense.row(ring_index(v_out)).setZero();
+    } // end for
+}
+
+// Correlates image with kernel into out, which is the same size as image, by
+// adding kernel centred on every set pixel. See correlate_rows().
+//
+// With a pool, out is split into bands of rows that are correlated in parallel.
+// Each band decodes its own input rows, including the half kernel of halo rows
+// around it, and writes only its own output rows, so the bands share no state.
+// Bands seek through the image's row index if it has one. Otherwise a row index
+// is built here before the bands start, rather than lazily in the image from
+// several threads at once, which would race.
+template <typename T=float>
+requires std::is_arithmetic_v<T>
+void correlate(const SparseImage<bool>& image, const ImArrayConstRef<T> &kernel, ImArrayRef<T> out,
+               codec::ThreadPool *pool = nullptr)
+{
+    using Eigen::Index;
+
+    const KernelKind kind = classify_kernel<T>(kernel);
+    const Index height = out.rows();
+
+    // Every band spreads kernel.rows() - 1 halo rows on top of its own, so bands
+    // are kept several kernels high.
+    const Index n_bands = pool
+        ? std::clamp<Index>(height / (4 * kernel.rows()), 1, 4 * static_cast<Index>(pool->size() + 1))
+        : 1;
+    if (1 == n_bands)
+    {
+        correlate_rows<T>(image, kernel, kind, 0, height, out);
+        return;
+    }
+
+    std::optional<RowIndex> local_index;
+    if (!image.has_row_index()) local_index.emplace(image.encoded_runs(), image.width(), image.height());
+    const RowIndex &row_index = local_index ? *local_index : image.row_index();
+
+    pool->parallel_for(n_bands, [&](size_t band_i) {
+        const Index v_begin = height * static_cast<Index>(band_i) / n_bands;
+        const Index v_end = height * static_cast<Index>(band_i + 1) / n_bands;
+        correlate_rows<T>(image, kernel, kind, v_begin, v_end, out, &row_index);
     });
-}
\ No newline at end of file
+}
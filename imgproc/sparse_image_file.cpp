@@ -0,0 +1,216 @@
+#include "imgproc/sparse_image_file.h"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+static_assert(std::endian::native == std::endian::little, "SparseImage files are little-endian");
+
+static constexpr uint64_t align_8(uint64_t n)
+{
+    return (n + 7) & ~uint64_t(7);
+}
+
+MappedFile::MappedFile(const std::filesystem::path &path) :
+    data_(),
+    size_()
+{
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        throw std::runtime_error("failed to open " + path.string());
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) < 0)
+    {
+        ::close(fd);
+        throw std::runtime_error("failed to stat " + path.string());
+    }
+
+    size_ = st.st_size;
+    if (size_)
+    {
+        void *data = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+        if (MAP_FAILED == data)
+        {
+            ::close(fd);
+            throw std::runtime_error("failed to map " + path.string());
+        }
+        data_ = static_cast<const uint8_t*>(data);
+    }
+
+    ::close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+    if (data_)
+    {
+        ::munmap(const_cast<uint8_t*>(data_), size_);
+    }
+}
+
+MappedFile::MappedFile(MappedFile &&other) noexcept :
+    data_(std::exchange(other.data_, nullptr)),
+    size_(std::exchange(other.size_, 0))
+{
+}
+
+MappedFile& MappedFile::operator=(MappedFile &&other) noexcept
+{
+    if (this != &other)
+    {
+        if (data_)
+        {
+            ::munmap(const_cast<uint8_t*>(data_), size_);
+        }
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+    }
+    return *this;
+}
+
+uint64_t sparse_image_file_checksum(std::span<const uint8_t> data, uint64_t checksum)
+{
+    for (uint8_t byte : data)
+    {
+        checksum = (checksum ^ byte) * 0x100000001b3;
+    }
+    return checksum;
+}
+
+static SparseImageFileHeader read_header(std::span<const uint8_t> file)
+{
+    SparseImageFileHeader header;
+    if (file.size() < sizeof(header))
+    {
+        throw std::runtime_error("file too small for a SparseImage header");
+    }
+    std::memcpy(&header, file.data(), sizeof(header));
+
+    if (header.magic != sparse_image_file_magic)
+    {
+        throw std::runtime_error("not a SparseImage file");
+    }
+    if (header.version != sparse_image_file_version)
+    {
+        throw std::runtime_error("unsupported SparseImage file version");
+    }
+    if (header.codec != sparse_image_file_codec_v2)
+    {
+        throw std::runtime_error("unsupported SparseImage codec");
+    }
+
+    const uint64_t payload_size = file.size() - sizeof(header);
+    if (header.runs_size > payload_size ||
+        header.row_index_size > payload_size - std::min(payload_size, align_8(header.runs_size)))
+    {
+        throw std::runtime_error("SparseImage file is truncated");
+    }
+
+    return header;
+}
+
+static std::span<const uint8_t> row_index_data(std::span<const uint8_t> file, const SparseImageFileHeader &header)
+{
+    return file.subspan(sizeof(header) + align_8(header.runs_size), header.row_index_size);
+}
+
+// Seek points are used to skip into the runs without further checks, so they
+// are validated even when the checksum is not: each one has to point within
+// the runs at or before the first pixel of its row, and neither offsets nor
+// pixels may go backwards.
+static void check_row_index(std::span<const SeekPoint> entries, const SparseImageFileHeader &header)
+{
+    uint64_t offset = 0;
+    uint64_t pixel = 0;
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        const SeekPoint &entry = entries[i];
+        const uint64_t row_pixel = static_cast<uint64_t>(i) * header.row_index_stride * header.width;
+        if (entry.offset > header.runs_size || entry.pixel > row_pixel ||
+            entry.offset < offset || entry.pixel < pixel || entry.value > 1)
+        {
+            throw std::runtime_error("SparseImage file row index is corrupt");
+        }
+        offset = entry.offset;
+        pixel = entry.pixel;
+    } // end for
+}
+
+SparseImageFile::SparseImageFile(const std::filesystem::path &path, bool verify) :
+    file_(path),
+    header_(read_header(file_.data())),
+    image_(header_.width, header_.height, file_.data().subspan(sizeof(header_), header_.runs_size)),
+    row_index_(header_.row_index_size ? row_index_data(file_.data(), header_) : std::span<const uint8_t>())
+{
+    if (header_.row_index_stride)
+    {
+        const size_t n_rows = header_.height;
+        const size_t n_entries = (n_rows + header_.row_index_stride - 1) / header_.row_index_stride;
+        if (row_index_.size() != n_entries * sizeof(SeekPoint))
+        {
+            throw std::runtime_error("SparseImage file row index does not match the image size");
+        }
+        const std::span<const SeekPoint> entries(reinterpret_cast<const SeekPoint*>(row_index_.data()), n_entries);
+        check_row_index(entries, header_);
+        image_.set_row_index(RowIndex(entries, header_.row_index_stride));
+    }
+
+    if (verify)
+    {
+        const uint64_t checksum = sparse_image_file_checksum(row_index_, sparse_image_file_checksum(image_.encoded_runs()));
+        if (checksum != header_.checksum)
+        {
+            throw std::runtime_error("SparseImage file checksum mismatch");
+        }
+    }
+}
+
+void save_sparse_image(const std::filesystem::path &path, const SparseImage<bool> &image)
+{
+    const std::span<const uint8_t> runs = image.encoded_runs();
+
+    SparseImageFileHeader header{};
+    header.magic = sparse_image_file_magic;
+    header.version = sparse_image_file_version;
+    header.codec = sparse_image_file_codec_v2;
+    header.width = image.width();
+    header.height = image.height();
+    header.runs_size = runs.size();
+
+    std::span<const uint8_t> row_index;
+    if (image.has_row_index())
+    {
+        const std::span<const SeekPoint> entries = image.row_index().entries();
+        row_index = std::span(reinterpret_cast<const uint8_t*>(entries.data()), entries.size_bytes());
+        header.row_index_stride = image.row_index().stride();
+        header.row_index_size = row_index.size();
+    }
+    header.checksum = sparse_image_file_checksum(row_index, sparse_image_file_checksum(runs));
+
+    const std::array<char, 8> padding{};
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(runs.data()), runs.size());
+    if (!row_index.empty())
+    {
+        file.write(padding.data(), align_8(runs.size()) - runs.size());
+        file.write(reinterpret_cast<const char*>(row_index.data()), row_index.size());
+    }
+
+    // Flush before checking, so that errors writing out the buffer are seen.
+    file.close();
+    if (!file)
+    {
+        throw std::runtime_error("failed to write " + path.string());
+    }
+}
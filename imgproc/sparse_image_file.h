@@ -0,0 +1,79 @@
+#pragma once
+
+#include "imgproc/sparse_image.h"
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+// On-disk layout of a binary SparseImage, little-endian:
+//
+//   SparseImageFileHeader          64 bytes
+//   run stream                     runs_size bytes, in the header's codec
+//   padding to a multiple of 8
+//   row index                      row_index_size bytes of SeekPoint entries
+//                                  (imgproc/row_index.h), optional
+//
+// The file is loaded by mapping it, so the image's runs point straight into the
+// page cache and loading takes constant time.
+struct SparseImageFileHeader
+{
+    std::array<char, 8> magic;
+    uint32_t version;
+    uint32_t codec;
+    uint64_t width;
+    uint64_t height;
+    uint64_t runs_size;
+    uint32_t row_index_stride;  // rows between row index entries, 0 if there is no index
+    uint32_t reserved;
+    uint64_t row_index_size;
+    uint64_t checksum;          // FNV-1a of the run stream followed by the row index
+};
+static_assert(sizeof(SparseImageFileHeader) == 64);
+
+constexpr std::array<char, 8> sparse_image_file_magic{'R', 'L', 'E', 'M', 'A', 'S', 'K', '\0'};
+constexpr uint32_t sparse_image_file_version = 1;
+constexpr uint32_t sparse_image_file_codec_v2 = 2;
+
+// Read-only memory mapping of a whole file.
+class MappedFile
+{
+  public:
+    explicit MappedFile(const std::filesystem::path &path);
+    ~MappedFile();
+
+    MappedFile(MappedFile &&other) noexcept;
+    MappedFile& operator=(MappedFile &&other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    std::span<const uint8_t> data() const { return {data_, size_}; }
+
+  private:
+    const uint8_t *data_;
+    size_t size_;
+};
+
+// A SparseImage file mapped into memory. image() refers to the mapping and must
+// not outlive this object.
+class SparseImageFile
+{
+  public:
+    // verify checks the checksum, which reads the whole file. The header and
+    // row index are always checked; without verify the run stream is trusted.
+    explicit SparseImageFile(const std::filesystem::path &path, bool verify = false);
+
+    const SparseImageFileHeader& header() const { return header_; }
+    const SparseImage<bool>& image() const { return image_; }
+    std::span<const uint8_t> row_index() const { return row_index_; }
+
+  private:
+    MappedFile file_;
+    SparseImageFileHeader header_;
+    SparseImage<bool> image_;
+    std::span<const uint8_t> row_index_;
+};
+
+void save_sparse_image(const std::filesystem::path &path, const SparseImage<bool> &image);
+
+uint64_t sparse_image_file_checksum(std::span<const uint8_t> data, uint64_t checksum = 0xcbf29ce484222325);
@@ -0,0 +1,285 @@
+#include <benchmark/benchmark.h>
+#include <Eigen/Dense>
+#include "codec/rle_mmr.h"
+#include "codec/rle_multi.h"
+#include "codec/rle_v1.h"
+#include "codec/rle_v2.h"
+#include "codec/rle_v2_framed.h"
+#include "codec/rle_v3.h"
+#include "codec/rle_v4.h"
+#include <array>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// Encode and decode benchmarks of every codec over image sizes, mask densities
+// and patterns. Run a subset with e.g. --benchmark_filter='decode/v2/blobs'.
+//
+// Counters:
+//   bytes_per_second     input bytes (one per pixel) per second
+//   pixels_per_second
+//   compression_ratio    pixels per encoded byte
+
+using Eigen::Array;
+using Eigen::Dynamic;
+using Eigen::Matrix;
+using Eigen::RowMajor;
+
+using Image = Array<uint8_t, Dynamic, Dynamic, RowMajor>;
+
+enum class Pattern
+{
+    NOISE,
+    BLOBS,
+    STRIPES,
+    ZEROS,
+    ONES,
+};
+
+static const char *pattern_name(Pattern pattern)
+{
+    switch (pattern)
+    {
+    case Pattern::NOISE: return "noise";
+    case Pattern::BLOBS: return "blobs";
+    case Pattern::STRIPES: return "stripes";
+    case Pattern::ZEROS: return "zeros";
+    case Pattern::ONES: return "ones";
+    }
+    return "";
+}
+
+// Roughly density_percent of the pixels are set.
+static Image make_image(Pattern pattern, Eigen::Index width, Eigen::Index height, int density_percent)
+{
+    const float density = 0.01f * density_percent;
+    Image x = Image::Zero(height, width);
+
+    switch (pattern)
+    {
+    case Pattern::NOISE:
+    {
+        const Array<float, Dynamic, Dynamic, RowMajor> rand_x = Matrix<float, Dynamic, Dynamic, RowMajor>::Random(height, width);
+        x = (rand_x > 1 - 2 * density).cast<uint8_t>();
+        break;
+    }
+
+    case Pattern::BLOBS:
+    {
+        // Discs of varying radius, placed independently so that they overlap
+        // like object masks do.
+        std::mt19937 rng(42);
+        const float mean_radius = width / 40.0f;
+        std::uniform_real_distribution<float> radius_dist(0.5f * mean_radius, 1.5f * mean_radius);
+        std::uniform_int_distribution<Eigen::Index> u_dist(0, width - 1);
+        std::uniform_int_distribution<Eigen::Index> v_dist(0, height - 1);
+
+        const float mean_area = 3.14159f * mean_radius * mean_radius * (1 + 0.25f / 3);
+        const size_t n_blobs = -std::log(1 - std::min(density, 0.99f)) * width * height / mean_area;
+        for (size_t blob_i = 0; blob_i < n_blobs; blob_i++)
+        {
+            const float radius = radius_dist(rng);
+            const Eigen::Index u0 = u_dist(rng);
+            const Eigen::Index v0 = v_dist(rng);
+            const Eigen::Index r = std::ceil(radius);
+            for (Eigen::Index v = std::max<Eigen::Index>(0, v0 - r); v <= std::min(height - 1, v0 + r); v++)
+            {
+                const float dv = v - v0;
+                const Eigen::Index half_width = std::sqrt(std::max(0.0f, radius * radius - dv * dv));
+                const Eigen::Index u_begin = std::max<Eigen::Index>(0, u0 - half_width);
+                const Eigen::Index u_end = std::min(width, u0 + half_width + 1);
+                x.row(v).segment(u_begin, u_end - u_begin) = 1;
+            }
+        }
+        break;
+    }
+
+    case Pattern::STRIPES:
+    {
+        // Diagonal stripes with a period of about 32 pixels. Sparse stripes
+        // need a longer period, since a stripe is at least one pixel wide.
+        const Eigen::Index duty = std::max<Eigen::Index>(1, (32 * density_percent + 50) / 100);
+        const Eigen::Index period = (100 * duty + density_percent / 2) / std::max(1, density_percent);
+        for (Eigen::Index v = 0; v < height; v++)
+        for (Eigen::Index u = 0; u < width; u++)
+        {
+            x(v, u) = (u + v) % period < duty;
+        }
+        break;
+    }
+
+    case Pattern::ZEROS:
+        break;
+
+    case Pattern::ONES:
+        x.setOnes();
+        break;
+    }
+
+    return x;
+}
+
+// The last image made, as generating a 12 MP image costs far more than
+// encoding it and benchmark functions run several times.
+static const Image& cached_image(Pattern pattern, Eigen::Index width, Eigen::Index height, int density_percent)
+{
+    static std::tuple<Pattern, Eigen::Index, Eigen::Index, int> key{};
+    static Image image;
+
+    const auto new_key = std::make_tuple(pattern, width, height, density_percent);
+    if (0 == image.size() || new_key != key)
+    {
+        image = make_image(pattern, width, height, density_percent);
+        key = new_key;
+    }
+    return image;
+}
+
+struct V1
+{
+    static constexpr const char *name = "v1";
+    static size_t max_encoded_size(size_t n_pixels, size_t) { return n_pixels + n_pixels / 128 + 16; }
+    static std::span<uint8_t> encode(std::span<const uint8_t> data, size_t, std::span<uint8_t> buff) { return rle::v1::encode(data, buff); }
+    static void decode(std::span<const uint8_t> rle, size_t, std::span<uint8_t> data) { rle::v1::decode(rle, data); }
+};
+
+struct V2
+{
+    static constexpr const char *name = "v2";
+    static size_t max_encoded_size(size_t n_pixels, size_t) { return rle::v2::max_encoded_size(n_pixels); }
+    static std::span<uint8_t> encode(std::span<const uint8_t> data, size_t, std::span<uint8_t> buff) { return rle::v2::encode(data, buff); }
+    static void decode(std::span<const uint8_t> rle, size_t, std::span<uint8_t> data) { rle::v2::decode(rle, data); }
+};
+
+struct V2Framed
+{
+    static constexpr const char *name = "v2_framed";
+    static constexpr size_t rows_per_band = 64;
+    static size_t max_encoded_size(size_t n_pixels, size_t width) { return rle::v2::framed::max_encoded_size(n_pixels, rows_per_band * width); }
+    static std::span<uint8_t> encode(std::span<const uint8_t> data, size_t width, std::span<uint8_t> buff) { return rle::v2::framed::encode(data, rows_per_band * width, buff); }
+    static void decode(std::span<const uint8_t> rle, size_t, std::span<uint8_t> data) { rle::v2::framed::decode(rle, data); }
+};
+
+struct V3
+{
+    static constexpr const char *name = "v3";
+    static size_t max_encoded_size(size_t n_pixels, size_t) { return rle::v3::max_encoded_size(n_pixels); }
+    static std::span<uint8_t> encode(std::span<const uint8_t> data, size_t, std::span<uint8_t> buff) { return rle::v3::encode(data, buff); }
+    static void decode(std::span<const uint8_t> rle, size_t, std::span<uint8_t> data) { rle::v3::decode(rle, data); }
+};
+
+struct V4
+{
+    static constexpr const char *name = "v4";
+    static size_t max_encoded_size(size_t n_pixels, size_t) { return rle::v4::max_encoded_size(n_pixels); }
+    static std::span<uint8_t> encode(std::span<const uint8_t> data, size_t, std::span<uint8_t> buff) { return rle::v4::encode(data, buff); }
+    static void decode(std::span<const uint8_t> rle, size_t, std::span<uint8_t> data) { rle::v4::decode(rle, data); }
+};
+
+struct Multi
+{
+    static constexpr const char *name = "multi";
+    static size_t max_encoded_size(size_t n_pixels, size_t) { return rle::multi::max_encoded_size<uint8_t>(n_pixels); }
+    static std::span<uint8_t> encode(std::span<const uint8_t> data, size_t, std::span<uint8_t> buff) { return rle::multi::encode(data, buff); }
+    static void decode(std::span<const uint8_t> rle, size_t, std::span<uint8_t> data) { rle::multi::decode(rle, data); }
+};
+
+struct Mmr
+{
+    static constexpr const char *name = "mmr";
+    static size_t max_encoded_size(size_t n_pixels, size_t width) { return rle::mmr::max_encoded_size(n_pixels, width); }
+    static std::span<uint8_t> encode(std::span<const uint8_t> data, size_t width, std::span<uint8_t> buff) { return rle::mmr::encode(data, width, buff); }
+    static void decode(std::span<const uint8_t> rle, size_t width, std::span<uint8_t> data) { rle::mmr::decode(rle, width, data); }
+};
+
+static void set_counters(benchmark::State &state, size_t n_pixels, size_t encoded_size)
+{
+    state.SetBytesProcessed(state.iterations() * n_pixels);
+    state.counters["pixels_per_second"] = benchmark::Counter(state.iterations() * n_pixels, benchmark::Counter::kIsRate);
+    state.counters["compression_ratio"] = static_cast<double>(n_pixels) / std::max<size_t>(1, encoded_size);
+}
+
+template <typename Codec>
+static void BM_encode(benchmark::State &state, Pattern pattern, Eigen::Index width, Eigen::Index height, int density_percent)
+{
+    const Image &x = cached_image(pattern, width, height, density_percent);
+    const std::span<const uint8_t> data(x.data(), x.size());
+
+    std::vector<uint8_t> buff(Codec::max_encoded_size(x.size(), width));
+
+    std::span<uint8_t> rle;
+    for (auto _ : state)
+    {
+        rle = Codec::encode(data, width, buff);
+        benchmark::DoNotOptimize(rle.data());
+    }
+
+    set_counters(state, x.size(), rle.size());
+}
+
+template <typename Codec>
+static void BM_decode(benchmark::State &state, Pattern pattern, Eigen::Index width, Eigen::Index height, int density_percent)
+{
+    const Image &x = cached_image(pattern, width, height, density_percent);
+
+    std::vector<uint8_t> buff(Codec::max_encoded_size(x.size(), width));
+    const std::span<uint8_t> rle = Codec::encode(std::span(x.data(), x.size()), width, buff);
+
+    Image x_decoded;
+    x_decoded.resizeLike(x);
+
+    for (auto _ : state)
+    {
+        Codec::decode(rle, width, std::span(x_decoded.data(), x_decoded.size()));
+        benchmark::ClobberMemory();
+    }
+
+    set_counters(state, x.size(), rle.size());
+}
+
+template <typename Codec>
+static void register_codec()
+{
+    constexpr std::array<std::pair<Eigen::Index, Eigen::Index>, 3> sizes{{
+        {640, 480},
+        {1920, 1080},
+        {4000, 3000},
+    }};
+    constexpr std::array<Pattern, 3> density_patterns{Pattern::NOISE, Pattern::BLOBS, Pattern::STRIPES};
+    constexpr std::array<int, 3> densities{1, 10, 50};
+
+    auto register_one = [](Pattern pattern, Eigen::Index width, Eigen::Index height, int density_percent) {
+        const std::string suffix = std::string(Codec::name) + "/" + pattern_name(pattern) + "/" +
+            std::to_string(width) + "x" + std::to_string(height) + "/" + std::to_string(density_percent) + "%";
+        benchmark::RegisterBenchmark(("encode/" + suffix).c_str(), BM_encode<Codec>, pattern, width, height, density_percent)
+            ->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark(("decode/" + suffix).c_str(), BM_decode<Codec>, pattern, width, height, density_percent)
+            ->Unit(benchmark::kMillisecond);
+    };
+
+    // Grouped by image so that consecutive benchmarks share the cached image.
+    for (auto [width, height] : sizes)
+    {
+        for (Pattern pattern : density_patterns)
+        {
+            for (int density_percent : densities)
+            {
+                register_one(pattern, width, height, density_percent);
+            }
+        }
+        register_one(Pattern::ZEROS, width, height, 0);
+        register_one(Pattern::ONES, width, height, 100);
+    }
+}
+
+static const bool registered = []() {
+    register_codec<V1>();
+    register_codec<V2>();
+    register_codec<V2Framed>();
+    register_codec<V3>();
+    register_codec<V4>();
+    register_codec<Multi>();
+    register_codec<Mmr>();
+    return true;
+}();
@@ -0,0 +1,76 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+#include "codec/leb128.h"
+
+// Run lengths of a mask: mostly single-byte values with some longer runs.
+static std::vector<uint8_t> make_encoded_run_lengths(size_t n)
+{
+    std::default_random_engine e1(42);
+    std::geometric_distribution<uint32_t> run_length_dist(0.02);
+
+    std::vector<uint8_t> encoded;
+    std::vector<uint8_t> buff(5);
+    for (size_t i = 0; i < n; i++)
+    {
+        std::span<uint8_t> encoded_val = codec::leb128::encode(run_length_dist(e1), buff);
+        encoded.insert(encoded.end(), encoded_val.begin(), encoded_val.end());
+    }
+    return encoded;
+}
+
+static void BM_leb128_decode_one(benchmark::State &state)
+{
+    const std::vector<uint8_t> encoded = make_encoded_run_lengths(state.range(0));
+    std::vector<uint32_t> decoded(state.range(0));
+
+    for (auto _ : state)
+    {
+        std::span<const uint8_t> remaining(encoded);
+        for (uint32_t &val : decoded)
+        {
+            auto [decoded_val, decoded_buff] = codec::leb128::decode_one<uint32_t>(remaining);
+            val = decoded_val;
+            remaining = remaining.subspan(decoded_buff.size());
+        }
+        benchmark::DoNotOptimize(decoded.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * decoded.size());
+}
+BENCHMARK(BM_leb128_decode_one)->Arg(1 << 20);
+
+static void BM_leb128_decode_u32(benchmark::State &state)
+{
+    const std::vector<uint8_t> encoded = make_encoded_run_lengths(state.range(0));
+    std::vector<uint32_t> decoded(state.range(0));
+
+    for (auto _ : state)
+    {
+        const uint8_t *it = encoded.data();
+        const uint8_t *end = encoded.data() + encoded.size();
+        for (uint32_t &val : decoded)
+        {
+            val = codec::leb128::decode_u32(it, end);
+        }
+        benchmark::DoNotOptimize(decoded.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * decoded.size());
+}
+BENCHMARK(BM_leb128_decode_u32)->Arg(1 << 20);
+
+static void BM_leb128_decode_many(benchmark::State &state)
+{
+    const std::vector<uint8_t> encoded = make_encoded_run_lengths(state.range(0));
+    std::vector<uint32_t> decoded(state.range(0));
+
+    for (auto _ : state)
+    {
+        codec::leb128::decode_many(encoded, decoded);
+        benchmark::DoNotOptimize(decoded.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * decoded.size());
+}
+BENCHMARK(BM_leb128_decode_many)->Arg(1 << 20);
@@ -1,7 +1,13 @@
 #include <benchmark/benchmark.h>
 #include <Eigen/Dense>
 #include <iostream>
+#include "codec/rle_mmr.h"
 #include "codec/rle_v1.h"
+#include "codec/rle_v2.h"
+#include "codec/rle_v2_batch.h"
+#include "codec/rle_v2_framed.h"
+#include "codec/rle_v3.h"
+#include "codec/rle_v4.h"
 
 using Eigen::Array;
 using Eigen::Dynamic;
@@ -17,10 +23,295 @@ static void BM_encode_v1(benchmark::State &state)
     Array<float, Dynamic, Dynamic> rand_x = Matrix<float, Dynamic, Dynamic>::Random(648, 480);
     Array<uint8_t, Dynamic, Dynamic, RowMajor> x = (rand_x > 0.9).cast<uint8_t>();
 
-    std::vector<uint8_t> buff(10e6);
+    std::vector<uint8_t> buff(x.size());
 
     std::span<uint8_t> rle;
     for (auto _ : state)
         rle = rle::v1::encode(std::span(x.data(), x.size()), buff);
 }
-BENCHMARK(BM_encode_v1)->Unit(benchmark::kMillisecond);
\ No newline at end of file
+BENCHMARK(BM_encode_v1)->Unit(benchmark::kMillisecond);
+
+static void BM_encode_v2(benchmark::State &state)
+{
+    Array<float, Dynamic, Dynamic> rand_x = Matrix<float, Dynamic, Dynamic>::Random(state.range(0), state.range(1));
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x = (rand_x > 0.9).cast<uint8_t>();
+
+    std::vector<uint8_t> buff(rle::v2::max_encoded_size(x.size()));
+
+    std::span<uint8_t> rle;
+    for (auto _ : state)
+        rle = rle::v2::encode(std::span(x.data(), x.size()), buff);
+
+    state.SetBytesProcessed(state.iterations() * x.size());
+}
+BENCHMARK(BM_encode_v2)
+    ->Args({648, 480})
+    ->Args({4000, 3000})
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_decode_v2(benchmark::State &state)
+{
+    Array<float, Dynamic, Dynamic> rand_x = Matrix<float, Dynamic, Dynamic>::Random(state.range(0), state.range(1));
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x = (rand_x > 0.9).cast<uint8_t>();
+
+    std::vector<uint8_t> buff(rle::v2::max_encoded_size(x.size()));
+    std::span<uint8_t> rle = rle::v2::encode(std::span(x.data(), x.size()), buff);
+
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x_decoded;
+    x_decoded.resizeLike(x);
+
+    for (auto _ : state)
+        rle::v2::decode(rle, std::span(x_decoded.data(), x_decoded.size()));
+
+    state.SetBytesProcessed(state.iterations() * x.size());
+}
+BENCHMARK(BM_decode_v2)
+    ->Args({648, 480})
+    ->Args({4000, 3000})
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_stats_v2(benchmark::State &state)
+{
+    Array<float, Dynamic, Dynamic> rand_x = Matrix<float, Dynamic, Dynamic>::Random(state.range(0), state.range(1));
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x = (rand_x > 0.9).cast<uint8_t>();
+
+    std::vector<uint8_t> buff(rle::v2::max_encoded_size(x.size()));
+    std::span<uint8_t> rle = rle::v2::encode(std::span(x.data(), x.size()), buff);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(rle::v2::stats(rle));
+
+    state.SetBytesProcessed(state.iterations() * x.size());
+}
+BENCHMARK(BM_stats_v2)
+    ->Args({648, 480})
+    ->Args({4000, 3000})
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_encode_v2_framed(benchmark::State &state)
+{
+    Array<float, Dynamic, Dynamic> rand_x = Matrix<float, Dynamic, Dynamic>::Random(4000, 3000);
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x = (rand_x > 0.9).cast<uint8_t>();
+
+    const size_t band_size = 64 * x.cols();
+    std::vector<uint8_t> buff(rle::v2::framed::max_encoded_size(x.size(), band_size));
+    // The calling thread also does work.
+    codec::ThreadPool pool(state.range(0) - 1);
+
+    std::span<uint8_t> rle;
+    for (auto _ : state)
+        rle = rle::v2::framed::encode(std::span(x.data(), x.size()), band_size, buff, &pool);
+
+    state.SetBytesProcessed(state.iterations() * x.size());
+}
+BENCHMARK(BM_encode_v2_framed)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_decode_v2_framed(benchmark::State &state)
+{
+    Array<float, Dynamic, Dynamic> rand_x = Matrix<float, Dynamic, Dynamic>::Random(4000, 3000);
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x = (rand_x > 0.9).cast<uint8_t>();
+
+    const size_t band_size = 64 * x.cols();
+    std::vector<uint8_t> buff(rle::v2::framed::max_encoded_size(x.size(), band_size));
+    std::span<uint8_t> rle = rle::v2::framed::encode(std::span(x.data(), x.size()), band_size, buff);
+    // The calling thread also does work.
+    codec::ThreadPool pool(state.range(0) - 1);
+
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x_decoded;
+    x_decoded.resizeLike(x);
+
+    for (auto _ : state)
+        rle::v2::framed::decode(rle, std::span(x_decoded.data(), x_decoded.size()), &pool);
+
+    state.SetBytesProcessed(state.iterations() * x.size());
+}
+BENCHMARK(BM_decode_v2_framed)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+static std::vector<Array<uint8_t, Dynamic, Dynamic, RowMajor>> make_instance_masks(size_t n_masks)
+{
+    std::vector<Array<uint8_t, Dynamic, Dynamic, RowMajor>> masks;
+    for (size_t i = 0; i < n_masks; i++)
+    {
+        Array<float, Dynamic, Dynamic> rand_x = Matrix<float, Dynamic, Dynamic>::Random(32 + i % 64, 32 + i % 48);
+        masks.push_back((rand_x > 0.95).cast<uint8_t>());
+    }
+    return masks;
+}
+
+static void BM_encode_v2_separate(benchmark::State &state)
+{
+    const auto masks = make_instance_masks(state.range(0));
+
+    size_t n_pixels = 0;
+    for (const auto &mask : masks) n_pixels += mask.size();
+
+    for (auto _ : state)
+    {
+        for (const auto &mask : masks)
+        {
+            std::vector<uint8_t> buff(rle::v2::max_encoded_size(mask.size()));
+            benchmark::DoNotOptimize(rle::v2::encode(std::span(mask.data(), mask.size()), buff));
+        }
+    }
+
+    state.SetBytesProcessed(state.iterations() * n_pixels);
+}
+BENCHMARK(BM_encode_v2_separate)
+    ->Arg(500)
+    ->Unit(benchmark::kMicrosecond);
+
+static void BM_encode_v2_batch(benchmark::State &state)
+{
+    const auto masks = make_instance_masks(state.range(0));
+
+    std::vector<std::span<const uint8_t>> data;
+    size_t n_pixels = 0;
+    for (const auto &mask : masks)
+    {
+        data.emplace_back(mask.data(), mask.size());
+        n_pixels += mask.size();
+    }
+
+    std::unique_ptr<codec::ThreadPool> pool;
+    if (state.range(1))
+    {
+        pool = std::make_unique<codec::ThreadPool>(state.range(1) - 1);
+    }
+
+    std::vector<uint8_t> arena(rle::v2::batch::max_encoded_size(data));
+    std::vector<size_t> offsets(data.size() + 1);
+    for (auto _ : state)
+        rle::v2::batch::encode(data, arena, offsets, pool.get());
+
+    state.SetBytesProcessed(state.iterations() * n_pixels);
+}
+BENCHMARK(BM_encode_v2_batch)
+    ->Args({500, 0})
+    ->Args({500, 4})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+static void BM_encode_v3(benchmark::State &state)
+{
+    Array<float, Dynamic, Dynamic> rand_x = Matrix<float, Dynamic, Dynamic>::Random(state.range(0), state.range(1));
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x = (rand_x > 0.9).cast<uint8_t>();
+
+    std::vector<uint8_t> buff(rle::v3::max_encoded_size(x.size()));
+
+    std::span<uint8_t> rle;
+    for (auto _ : state)
+        rle = rle::v3::encode(std::span(x.data(), x.size()), buff);
+
+    state.SetBytesProcessed(state.iterations() * x.size());
+}
+BENCHMARK(BM_encode_v3)
+    ->Args({648, 480})
+    ->Args({4000, 3000})
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_decode_v3(benchmark::State &state)
+{
+    Array<float, Dynamic, Dynamic> rand_x = Matrix<float, Dynamic, Dynamic>::Random(state.range(0), state.range(1));
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x = (rand_x > 0.9).cast<uint8_t>();
+
+    std::vector<uint8_t> buff(rle::v3::max_encoded_size(x.size()));
+    std::span<uint8_t> rle = rle::v3::encode(std::span(x.data(), x.size()), buff);
+
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x_decoded;
+    x_decoded.resizeLike(x);
+
+    for (auto _ : state)
+        rle::v3::decode(rle, std::span(x_decoded.data(), x_decoded.size()));
+
+    state.SetBytesProcessed(state.iterations() * x.size());
+}
+BENCHMARK(BM_decode_v3)
+    ->Args({648, 480})
+    ->Args({4000, 3000})
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_encode_v4(benchmark::State &state)
+{
+    Array<float, Dynamic, Dynamic> rand_x = Matrix<float, Dynamic, Dynamic>::Random(state.range(0), state.range(1));
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x = (rand_x > 0.9).cast<uint8_t>();
+
+    std::vector<uint8_t> buff(rle::v4::max_encoded_size(x.size()));
+
+    std::span<uint8_t> rle;
+    for (auto _ : state)
+        rle = rle::v4::encode(std::span(x.data(), x.size()), buff);
+
+    state.SetBytesProcessed(state.iterations() * x.size());
+}
+BENCHMARK(BM_encode_v4)
+    ->Args({648, 480})
+    ->Args({4000, 3000})
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_decode_v4(benchmark::State &state)
+{
+    Array<float, Dynamic, Dynamic> rand_x = Matrix<float, Dynamic, Dynamic>::Random(state.range(0), state.range(1));
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x = (rand_x > 0.9).cast<uint8_t>();
+
+    std::vector<uint8_t> buff(rle::v4::max_encoded_size(x.size()));
+    std::span<uint8_t> rle = rle::v4::encode(std::span(x.data(), x.size()), buff);
+
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x_decoded;
+    x_decoded.resizeLike(x);
+
+    for (auto _ : state)
+        rle::v4::decode(rle, std::span(x_decoded.data(), x_decoded.size()));
+
+    state.SetBytesProcessed(state.iterations() * x.size());
+}
+BENCHMARK(BM_decode_v4)
+    ->Args({648, 480})
+    ->Args({4000, 3000})
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_encode_mmr(benchmark::State &state)
+{
+    Array<float, Dynamic, Dynamic> rand_x = Matrix<float, Dynamic, Dynamic>::Random(state.range(0), state.range(1));
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x = (rand_x > 0.9).cast<uint8_t>();
+
+    std::vector<uint8_t> buff(rle::mmr::max_encoded_size(x.size(), x.cols()));
+
+    std::span<uint8_t> rle;
+    for (auto _ : state)
+        rle = rle::mmr::encode(std::span(x.data(), x.size()), x.cols(), buff);
+
+    state.SetBytesProcessed(state.iterations() * x.size());
+}
+BENCHMARK(BM_encode_mmr)
+    ->Args({648, 480})
+    ->Args({4000, 3000})
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_decode_mmr(benchmark::State &state)
+{
+    Array<float, Dynamic, Dynamic> rand_x = Matrix<float, Dynamic, Dynamic>::Random(state.range(0), state.range(1));
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x = (rand_x > 0.9).cast<uint8_t>();
+
+    std::vector<uint8_t> buff(rle::mmr::max_encoded_size(x.size(), x.cols()));
+    std::span<uint8_t> rle = rle::mmr::encode(std::span(x.data(), x.size()), x.cols(), buff);
+
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x_decoded;
+    x_decoded.resizeLike(x);
+
+    for (auto _ : state)
+        rle::mmr::decode(rle, x.cols(), std::span(x_decoded.data(), x_decoded.size()));
+
+    state.SetBytesProcessed(state.iterations() * x.size());
+}
+BENCHMARK(BM_decode_mmr)
+    ->Args({648, 480})
+    ->Args({4000, 3000})
+    ->Unit(benchmark::kMillisecond);
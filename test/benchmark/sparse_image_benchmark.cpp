@@ -1,7 +1,12 @@
 
 #include <benchmark/benchmark.h>
 #include <Eigen/Dense>
+#include <cmath>
 #include <iostream>
+#include <memory>
+#include "imgproc/cwise_binary_op.h"
+#include "imgproc/morphology.h"
+#include "imgproc/ops.h"
 #include "imgproc/sparse_image.h"
 
 using Eigen::Array;
@@ -19,8 +24,6 @@ static void BM_sparse_image_ctor(benchmark::State &state)
     const float threshold = 0.01 * state.range(0);
     ImArray<bool> x = rand_x > threshold;
 
-    std::vector<uint8_t> buff(10e6);
-
     for (auto _ : state)
     {
         SparseImage sparse_image(x);
@@ -30,13 +33,49 @@ BENCHMARK(BM_sparse_image_ctor)
     ->DenseRange(80, 100, 2)
     ->Unit(benchmark::kMillisecond);
 
+static void BM_threshold_sparse_image_ctor(benchmark::State &state)
+{
+    ImArray<float> rand_x = Matrix<float, Dynamic, Dynamic>::Random(state.range(0), state.range(1));
+    const float threshold = 0.9;
+
+    for (auto _ : state)
+    {
+        ImArray<bool> x = rand_x > threshold;
+        SparseImage sparse_image(x);
+        benchmark::DoNotOptimize(sparse_image);
+    }
+
+    state.SetBytesProcessed(state.iterations() * rand_x.size() * sizeof(float));
+}
+BENCHMARK(BM_threshold_sparse_image_ctor)
+    ->Args({648, 480})
+    ->Args({4000, 3000})
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_make_sparse_image(benchmark::State &state)
+{
+    ImArray<float> rand_x = Matrix<float, Dynamic, Dynamic>::Random(state.range(0), state.range(1));
+    const float threshold = 0.9;
+
+    for (auto _ : state)
+    {
+        SparseImage sparse_image = make_sparse_image(rand_x, ops::unary::predicate::Greater<float>{threshold});
+        benchmark::DoNotOptimize(sparse_image);
+    }
+
+    state.SetBytesProcessed(state.iterations() * rand_x.size() * sizeof(float));
+}
+BENCHMARK(BM_make_sparse_image)
+    ->Args({648, 480})
+    ->Args({4000, 3000})
+    ->Unit(benchmark::kMillisecond);
+
 static void BM_from_sparse_image(benchmark::State &state)
 {
     ImArray<float> rand_x = Matrix<float, Dynamic, Dynamic>::Random(648, 480);
     const float threshold = 0.01 * state.range(0);
     ImArray<bool> x = rand_x > threshold;
 
-    std::vector<uint8_t> buff(10e6);
     SparseImage sparse_image(x);
 
     ImArray<bool> x_out;
@@ -51,6 +90,249 @@ BENCHMARK(BM_from_sparse_image)
     ->DenseRange(80, 100, 2)
     ->Unit(benchmark::kMillisecond);
 
+static void BM_visit_sparse_image(benchmark::State &state)
+{
+    ImArray<float> rand_x = Matrix<float, Dynamic, Dynamic>::Random(648, 480);
+    const float threshold = 0.01 * state.range(0);
+    ImArray<bool> x = rand_x > threshold;
+
+    SparseImage sparse_image(x);
+
+    for (auto _ : state)
+    {
+        size_t n_ones = 0;
+        visit_sparse_image(sparse_image, [&](Eigen::Index, Eigen::Index, bool val) { n_ones += val; });
+        benchmark::DoNotOptimize(n_ones);
+    }
+}
+BENCHMARK(BM_visit_sparse_image)
+    ->DenseRange(80, 100, 10)
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_visit_runs(benchmark::State &state)
+{
+    ImArray<float> rand_x = Matrix<float, Dynamic, Dynamic>::Random(648, 480);
+    const float threshold = 0.01 * state.range(0);
+    ImArray<bool> x = rand_x > threshold;
+
+    SparseImage sparse_image(x);
+
+    for (auto _ : state)
+    {
+        size_t n_ones = 0;
+        visit_runs(sparse_image, [&](Eigen::Index, Eigen::Index u_begin, Eigen::Index u_end, bool val) {
+            n_ones += val ? u_end - u_begin : 0;
+        });
+        benchmark::DoNotOptimize(n_ones);
+    }
+}
+BENCHMARK(BM_visit_runs)
+    ->DenseRange(80, 100, 10)
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_from_sparse_image_roi(benchmark::State &state)
+{
+    ImArray<float> rand_x = Matrix<float, Dynamic, Dynamic>::Random(648, 480);
+    ImArray<bool> x = rand_x > 0.9;
+
+    SparseImage sparse_image(x);
+
+    // A centred crop of 1/state.range(0) of the rows and columns
+    const Eigen::Index height = x.rows() / state.range(0);
+    const Eigen::Index width = x.cols() / state.range(0);
+    ImArray<bool> x_out(height, width);
+
+    for (auto _ : state)
+    {
+        from_sparse_image<bool>(sparse_image, (x.cols() - width) / 2, (x.rows() - height) / 2, x_out);
+    }
+}
+BENCHMARK(BM_from_sparse_image_roi)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_correlate(benchmark::State &state)
+{
+    ImArray<float> rand_x = Matrix<float, Dynamic, Dynamic>::Random(648, 480);
+    ImArray<bool> x = rand_x > 0.8;
+    x.block(200, 100, 200, 200) = true;
+
+    SparseImage sparse_image(x);
+
+    // state.range(0) picks a general, separable or box kernel of size state.range(1)
+    const Eigen::Index size = state.range(1);
+    ImArray<float> kernel = Matrix<float, Dynamic, Dynamic>::Random(size, size);
+    if (1 == state.range(0)) kernel = (kernel.col(0).matrix() * kernel.row(0).matrix()).array();
+    if (2 == state.range(0)) kernel.setConstant(1.0f / (size * size));
+
+    ImArray<float> out(x.rows(), x.cols());
+
+    for (auto _ : state)
+    {
+        out.setZero();
+        correlate<float>(sparse_image, kernel, out);
+        benchmark::DoNotOptimize(out.data());
+    }
+}
+BENCHMARK(BM_correlate)
+    ->ArgsProduct({{0, 1, 2}, {3, 15}})
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_correlate_parallel(benchmark::State &state)
+{
+    ImArray<float> rand_x = Matrix<float, Dynamic, Dynamic>::Random(1296, 960);
+    ImArray<bool> x = rand_x > 0.95;
+    x.block(400, 200, 400, 400) = true;
+
+    SparseImage sparse_image(x);
+    sparse_image.build_row_index();
+
+    ImArray<float> kernel = Matrix<float, Dynamic, Dynamic>::Random(31, 31);
+    ImArray<float> out(x.rows(), x.cols());
+
+    // state.range(0) threads, or none for the serial version
+    std::unique_ptr<codec::ThreadPool> pool;
+    if (state.range(0)) pool = std::make_unique<codec::ThreadPool>(state.range(0));
+
+    for (auto _ : state)
+    {
+        out.setZero();
+        correlate<float>(sparse_image, kernel, out, pool.get());
+        benchmark::DoNotOptimize(out.data());
+    }
+}
+BENCHMARK(BM_correlate_parallel)
+    ->Arg(0)
+    ->Arg(1)
+    ->Arg(3)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// Smooth blobs covering roughly (100 - threshold)% of the image, the kind of
+// masks that are combined in practice.
+static ImArray<bool> blob_mask(Eigen::Index rows, Eigen::Index cols, float phase, int threshold)
+{
+    ImArray<float> x(rows, cols);
+    for (Eigen::Index v = 0; v < rows; ++v)
+    for (Eigen::Index u = 0; u < cols; ++u)
+    {
+        x(v, u) = std::sin(0.05f * u + phase) * std::cos(0.03f * v - phase);
+    }
+    return x > 0.01f * (2 * threshold - 100);
+}
+
+static void BM_combine_to_dense(benchmark::State &state)
+{
+    SparseImage<bool> sparse_a(blob_mask(648, 480, 0.0f, state.range(0)));
+    SparseImage<bool> sparse_b(blob_mask(648, 480, 1.0f, state.range(0)));
+
+    auto operation = BinaryOp{sparse_a, sparse_b, ops::binary::boolean::Or()};
+    std::allocator<bool> alloc;
+    ImArray<bool> out(sparse_a.height(), sparse_a.width());
+
+    for (auto _ : state)
+    {
+        out.setZero();
+        operation.eval_to(out, alloc);
+        benchmark::DoNotOptimize(out.data());
+    }
+}
+BENCHMARK(BM_combine_to_dense)
+    ->DenseRange(80, 100, 10)
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_combine(benchmark::State &state)
+{
+    SparseImage<bool> sparse_a(blob_mask(648, 480, 0.0f, state.range(0)));
+    SparseImage<bool> sparse_b(blob_mask(648, 480, 1.0f, state.range(0)));
+
+    for (auto _ : state)
+    {
+        SparseImage<bool> out = combine(sparse_a, sparse_b, ops::binary::boolean::Or());
+        benchmark::DoNotOptimize(out.encoded_runs().data());
+    }
+}
+BENCHMARK(BM_combine)
+    ->DenseRange(80, 100, 10)
+    ->Unit(benchmark::kMillisecond);
+
+// Decode, dilate by a state.range(0) square with shifted copies and re-encode,
+// for comparison with BM_dilate.
+static void BM_dilate_dense(benchmark::State &state)
+{
+    SparseImage<bool> sparse_image(blob_mask(1296, 960, 0.0f, 80));
+    const Eigen::Index r = state.range(0) / 2;
+    const Eigen::Index rows = sparse_image.height();
+    const Eigen::Index cols = sparse_image.width();
+
+    ImArray<bool> x(rows, cols);
+    ImArray<bool> wide(rows, cols);
+    ImArray<bool> out(rows, cols);
+
+    for (auto _ : state)
+    {
+        from_sparse_image<bool>(sparse_image, x);
+
+        wide = x;
+        for (Eigen::Index d = 1; d <= r; ++d)
+        {
+            wide.rightCols(cols - d) = wide.rightCols(cols - d) || x.leftCols(cols - d);
+            wide.leftCols(cols - d) = wide.leftCols(cols - d) || x.rightCols(cols - d);
+        } // end for d
+
+        out = wide;
+        for (Eigen::Index d = 1; d <= r; ++d)
+        {
+            out.bottomRows(rows - d) = out.bottomRows(rows - d) || wide.topRows(rows - d);
+            out.topRows(rows - d) = out.topRows(rows - d) || wide.bottomRows(rows - d);
+        } // end for d
+
+        SparseImage<bool> dilated(out);
+        benchmark::DoNotOptimize(dilated.encoded_runs().data());
+    }
+}
+BENCHMARK(BM_dilate_dense)
+    ->Arg(3)
+    ->Arg(15)
+    ->Arg(31)
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_dilate(benchmark::State &state)
+{
+    SparseImage<bool> sparse_image(blob_mask(1296, 960, 0.0f, 80));
+    const StructuringElement element = StructuringElement::rect(state.range(0), state.range(0));
+
+    for (auto _ : state)
+    {
+        SparseImage<bool> dilated = dilate(sparse_image, element);
+        benchmark::DoNotOptimize(dilated.encoded_runs().data());
+    }
+}
+BENCHMARK(BM_dilate)
+    ->Arg(3)
+    ->Arg(15)
+    ->Arg(31)
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_erode(benchmark::State &state)
+{
+    SparseImage<bool> sparse_image(blob_mask(1296, 960, 0.0f, 80));
+    const StructuringElement element = StructuringElement::rect(state.range(0), state.range(0));
+
+    for (auto _ : state)
+    {
+        SparseImage<bool> eroded = erode(sparse_image, element);
+        benchmark::DoNotOptimize(eroded.encoded_runs().data());
+    }
+}
+BENCHMARK(BM_erode)
+    ->Arg(3)
+    ->Arg(15)
+    ->Arg(31)
+    ->Unit(benchmark::kMillisecond);
+
 static void BM_copy_image_dense(benchmark::State &state)
 {
     ImArray<float> rand_x = Matrix<float, Dynamic, Dynamic>::Random(648, 480);
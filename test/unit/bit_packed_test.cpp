@@ -0,0 +1,71 @@
+#include "codec/bit_packed.h"
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <vector>
+
+using ::testing::ElementsAre;
+using namespace codec;
+
+TEST(bit_packed, row_stride)
+{
+    EXPECT_EQ(bit_packed::row_stride(0), 0);
+    EXPECT_EQ(bit_packed::row_stride(1), 1);
+    EXPECT_EQ(bit_packed::row_stride(64), 1);
+    EXPECT_EQ(bit_packed::row_stride(65), 2);
+}
+
+TEST(bit_packed, visit_runs)
+{
+    // 2 rows of 70 pixels. Padding bits past the width must be ignored.
+    std::vector<uint64_t> words{
+        0b1001, ~uint64_t(0) << 6,
+        ~uint64_t(0), 0};
+
+    std::vector<size_t> runs;
+    bit_packed::visit_runs(bit_packed::ConstMask{words, 70, 2, 2}, [&](size_t run_length) {
+        runs.push_back(run_length);
+    });
+
+    EXPECT_THAT(runs, ElementsAre(0, 1, 2, 1, 66, 64, 6));
+}
+
+TEST(bit_packed, visit_runs__all_zeros)
+{
+    std::vector<uint64_t> words(6);
+
+    std::vector<size_t> runs;
+    bit_packed::visit_runs(bit_packed::ConstMask{words, 100, 3, 2}, [&](size_t run_length) {
+        runs.push_back(run_length);
+    });
+
+    EXPECT_THAT(runs, ElementsAre(300));
+}
+
+TEST(bit_packed, writer)
+{
+    std::vector<uint64_t> words(4, 0xaaaaaaaaaaaaaaaa);
+    bit_packed::Writer writer(bit_packed::Mask{words, 70, 2, 2});
+
+    writer.write(3, false);
+    writer.write(66, true);
+    writer.write(2, false);
+    EXPECT_EQ(writer.remaining(), 69);
+    writer.write(69, true);
+    EXPECT_EQ(writer.remaining(), 0);
+    EXPECT_THROW(writer.write(1, true), std::runtime_error);
+
+    EXPECT_EQ(words[0], ~uint64_t(0) << 3);
+    // Bits 64..68 set, bit 69 cleared, padding untouched.
+    EXPECT_EQ(words[1], (0xaaaaaaaaaaaaaaaa & ~uint64_t(0x3f)) | 0x1f);
+    EXPECT_EQ(words[2], ~uint64_t(0) << 1);
+    EXPECT_EQ(words[3], (0xaaaaaaaaaaaaaaaa & ~uint64_t(0x3f)) | 0x3f);
+}
+
+TEST(bit_packed, check)
+{
+    std::vector<uint64_t> words(4);
+
+    EXPECT_THROW((bit_packed::ConstMask{words, 70, 2, 1}.check()), std::runtime_error);
+    EXPECT_THROW((bit_packed::ConstMask{words, 70, 3, 2}.check()), std::runtime_error);
+    EXPECT_NO_THROW((bit_packed::ConstMask{words, 70, 2, 2}.check()));
+}
@@ -0,0 +1,38 @@
+#include "codec/bit_stream.h"
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <vector>
+
+using ::testing::ElementsAre;
+using namespace codec;
+
+TEST(bit_stream, write_read)
+{
+    std::vector<uint8_t> buff(8);
+    bit_stream::Writer writer(buff);
+    writer.write(0b101, 3);
+    writer.write(0xabcd, 16);
+    writer.write(0x7fffffff, 31);
+    writer.write(1, 1);
+    std::span<uint8_t> written = writer.finish();
+
+    EXPECT_EQ(written.size(), 7);
+
+    bit_stream::Reader reader(written);
+    EXPECT_EQ(reader.peek(3), 0b101);
+    EXPECT_EQ(reader.read(3), 0b101);
+    EXPECT_EQ(reader.read(16), 0xabcd);
+    EXPECT_EQ(reader.read(31), 0x7fffffff);
+    EXPECT_EQ(reader.read(1), 1);
+    EXPECT_EQ(reader.bits_left(), 5);
+    EXPECT_EQ(reader.read(5), 0);
+    EXPECT_THROW(reader.read(1), std::runtime_error);
+}
+
+TEST(bit_stream, writer__buffer_too_small)
+{
+    std::vector<uint8_t> buff(1);
+    bit_stream::Writer writer(buff);
+    writer.write(0xff, 8);
+    EXPECT_THROW(writer.write(1, 8), std::runtime_error);
+}
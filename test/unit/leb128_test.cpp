@@ -47,6 +47,17 @@ TEST(LEB128, encode)
     EXPECT_THAT(encoded, ElementsAre(0xf1, 0x87, 0xa3, 0x88, 0x0b));
 }
 
+TEST(LEB128, encoded_size)
+{
+    EXPECT_EQ(leb128::encoded_size(uint32_t(0)), 1);
+    EXPECT_EQ(leb128::encoded_size(uint32_t(127)), 1);
+    EXPECT_EQ(leb128::encoded_size(uint32_t(128)), 2);
+    EXPECT_EQ(leb128::encoded_size(uint32_t(16383)), 2);
+    EXPECT_EQ(leb128::encoded_size(uint32_t(16384)), 3);
+    EXPECT_EQ(leb128::encoded_size(uint32_t(0xb108c3f1)), 5);
+    EXPECT_EQ(leb128::encoded_size(uint64_t(0x100000000)), 5);
+}
+
 TEST(LEB128, decode_one)
 {
     std::vector<uint8_t> encoded;
@@ -68,6 +79,31 @@ TEST(LEB128, decode_one)
     EXPECT_EQ(val, 2970141681);
 }
 
+TEST(LEB128, decode_u32)
+{
+    const std::vector<uint8_t> encoded{1, 0x80, 0x01, 0xf1, 0x87, 0xa3, 0x88, 0x0b};
+    const uint8_t *it = encoded.data();
+    const uint8_t *end = encoded.data() + encoded.size();
+
+    EXPECT_EQ(leb128::decode_u32(it, end), 1);
+    EXPECT_EQ(leb128::decode_u32(it, end), 128);
+    EXPECT_EQ(leb128::decode_u32(it, end), 2970141681);
+    EXPECT_EQ(it, end);
+
+    const std::vector<uint8_t> truncated{0x80, 0x80};
+    it = truncated.data();
+    EXPECT_THROW(leb128::decode_u32(it, truncated.data() + truncated.size()), std::runtime_error);
+
+    // UINT32_MAX is the largest value five bytes may carry.
+    const std::vector<uint8_t> max{0xff, 0xff, 0xff, 0xff, 0x0f};
+    it = max.data();
+    EXPECT_EQ(leb128::decode_u32(it, max.data() + max.size()), UINT32_MAX);
+
+    const std::vector<uint8_t> too_large{0xff, 0xff, 0xff, 0xff, 0x1f};
+    it = too_large.data();
+    EXPECT_THROW(leb128::decode_u32(it, too_large.data() + too_large.size()), std::runtime_error);
+}
+
 TEST(LEB128, encode_decode__3000x4000)
 {
     std::vector<uint8_t> buff(5);
@@ -92,4 +128,49 @@ TEST(LEB128, encode_decode)
         auto [decoded_val, encoded_val_buff] = leb128::decode_one<uint32_t>(encoded);
         EXPECT_EQ(decoded_val, val);
     }
-}
\ No newline at end of file
+}
+
+TEST(LEB128, decode_many)
+{
+    std::random_device r;
+    std::default_random_engine e1(r());
+    std::uniform_int_distribution<uint32_t> uniform_dist;
+    std::uniform_int_distribution<uint32_t> small_dist(0, 127);
+    std::bernoulli_distribution is_small(0.8);
+
+    std::vector<uint32_t> values(1000);
+    std::vector<uint8_t> encoded;
+    std::vector<uint8_t> buff(5);
+    for (uint32_t &val : values)
+    {
+        val = is_small(e1) ? small_dist(e1) : uniform_dist(e1);
+        std::span<uint8_t> encoded_val = leb128::encode(val, buff);
+        encoded.insert(encoded.end(), encoded_val.begin(), encoded_val.end());
+    }
+
+    // Decode in uneven batches to exercise the limits of both buffers.
+    std::vector<uint32_t> decoded;
+    std::span<const uint8_t> remaining(encoded);
+    std::vector<uint32_t> batch(37);
+    while (!remaining.empty())
+    {
+        auto [n, decoded_buff] = leb128::decode_many(remaining, batch);
+        decoded.insert(decoded.end(), batch.begin(), batch.begin() + n);
+        remaining = remaining.subspan(decoded_buff.size());
+    }
+
+    EXPECT_EQ(decoded, values);
+}
+
+TEST(LEB128, decode_many__truncated)
+{
+    std::vector<uint8_t> encoded(20, 1);
+    encoded.push_back(0x80);
+
+    std::vector<uint32_t> out(32);
+    EXPECT_THROW(leb128::decode_many(encoded, out), std::runtime_error);
+
+    auto [n, decoded_buff] = leb128::decode_many(std::span(encoded).first(20), out);
+    EXPECT_EQ(n, 20);
+    EXPECT_EQ(decoded_buff.size(), 20);
+}
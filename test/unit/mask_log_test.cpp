@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <Eigen/Dense>
+#include "imgproc/mask_log.h"
+#include "test_util.h"
+#include <atomic>
+#include <filesystem>
+#include <thread>
+#include <vector>
+
+using Eigen::Dynamic;
+using Eigen::Matrix;
+
+class MaskLogTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        path_ = unique_temp_path("mask_log_test");
+        std::filesystem::remove(path_);
+        std::filesystem::remove(mask_log_index_path(path_));
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(path_);
+        std::filesystem::remove(mask_log_index_path(path_));
+    }
+
+    static ImArray<bool> make_frame(size_t n)
+    {
+        ImArray<bool> x(30 + n % 7, 40);
+        x.setConstant(0);
+        x.block(n % 20, n % 30, 5, 8) = 1;
+        return x;
+    }
+
+    std::filesystem::path path_;
+};
+
+TEST_F(MaskLogTest, append_read)
+{
+    {
+        MaskLogWriter writer(path_);
+        for (size_t n = 0; n < 50; n++)
+        {
+            EXPECT_EQ(writer.append(SparseImage<bool>(make_frame(n))), n);
+        }
+    }
+
+    MaskLogReader reader(path_);
+    ASSERT_EQ(reader.size(), 50u);
+    for (size_t n : {0, 17, 49, 3})
+    {
+        const MaskLogFrame frame = reader.frame(n);
+        EXPECT_TRUE((to_dense(frame.image) == make_frame(n)).all()) << n;
+    }
+    EXPECT_THROW(reader.frame(50), std::runtime_error);
+}
+
+TEST_F(MaskLogTest, reopen_append)
+{
+    {
+        MaskLogWriter writer(path_);
+        writer.append(SparseImage<bool>(make_frame(0)));
+    }
+    {
+        MaskLogWriter writer(path_);
+        EXPECT_EQ(writer.size(), 1u);
+        EXPECT_EQ(writer.append(SparseImage<bool>(make_frame(1))), 1u);
+    }
+
+    MaskLogReader reader(path_);
+    ASSERT_EQ(reader.size(), 2u);
+    EXPECT_TRUE((to_dense(reader.frame(0).image) == make_frame(0)).all());
+    EXPECT_TRUE((to_dense(reader.frame(1).image) == make_frame(1)).all());
+}
+
+TEST_F(MaskLogTest, frame_outlives_refresh)
+{
+    MaskLogWriter writer(path_);
+    writer.append(SparseImage<bool>(make_frame(0)));
+
+    MaskLogReader reader(path_);
+    const MaskLogFrame frame = reader.frame(0);
+
+    for (size_t n = 1; n < 10; n++)
+    {
+        writer.append(SparseImage<bool>(make_frame(n)));
+    }
+    EXPECT_EQ(reader.refresh(), 10u);
+
+    EXPECT_TRUE((to_dense(frame.image) == make_frame(0)).all());
+    EXPECT_TRUE((to_dense(reader.frame(9).image) == make_frame(9)).all());
+}
+
+TEST_F(MaskLogTest, concurrent_readers)
+{
+    const size_t n_frames = 500;
+
+    MaskLogWriter writer(path_);
+    writer.append(SparseImage<bool>(make_frame(0)));
+    MaskLogReader reader(path_);
+
+    std::atomic<size_t> n_written{1};
+    std::atomic<bool> failed{false};
+
+    std::vector<std::thread> threads;
+    for (size_t thread_i = 0; thread_i < 4; thread_i++)
+    {
+        threads.emplace_back([&, thread_i]() {
+            for (size_t i = 0; i < 2000; i++)
+            {
+                const size_t n = (i * 7 + thread_i) % n_written.load();
+                const MaskLogFrame frame = reader.frame(n);
+                if (!(to_dense(frame.image) == make_frame(n)).all())
+                {
+                    failed = true;
+                }
+            }
+        });
+    }
+
+    for (size_t n = 1; n < n_frames; n++)
+    {
+        writer.append(SparseImage<bool>(make_frame(n)));
+        n_written = n + 1;
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_FALSE(failed);
+}
+
+TEST_F(MaskLogTest, open__missing)
+{
+    EXPECT_THROW(MaskLogReader reader(path_), std::runtime_error);
+}
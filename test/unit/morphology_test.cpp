@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <Eigen/Dense>
+#include "imgproc/morphology.h"
+#include "imgproc/sparse_image.h"
+#include "test_util.h"
+#include <stdexcept>
+
+using Eigen::Index;
+
+// Dense morphology with a neutral border: outside the image is zero for
+// dilation and one for erosion.
+static ImArray<bool> dilate_reference(const ImArray<bool> &x, const StructuringElement &element)
+{
+    ImArray<bool> out = ImArray<bool>::Constant(x.rows(), x.cols(), false);
+    for (Index v = 0; v < x.rows(); ++v)
+    for (Index u = 0; u < x.cols(); ++u)
+    for (Index dv = -element.half_height; dv <= element.half_height; ++dv)
+    for (Index du = -element.half_width; du <= element.half_width; ++du)
+    {
+        if (StructuringElement::Shape::CROSS == element.shape && 0 != dv && 0 != du) continue;
+
+        const Index v_in = v + dv;
+        const Index u_in = u + du;
+        if (v_in >= 0 && v_in < x.rows() && u_in >= 0 && u_in < x.cols() && x(v_in, u_in))
+        {
+            out(v, u) = true;
+        }
+    }
+    return out;
+}
+
+static ImArray<bool> erode_reference(const ImArray<bool> &x, const StructuringElement &element)
+{
+    ImArray<bool> out = ImArray<bool>::Constant(x.rows(), x.cols(), true);
+    for (Index v = 0; v < x.rows(); ++v)
+    for (Index u = 0; u < x.cols(); ++u)
+    for (Index dv = -element.half_height; dv <= element.half_height; ++dv)
+    for (Index du = -element.half_width; du <= element.half_width; ++du)
+    {
+        if (StructuringElement::Shape::CROSS == element.shape && 0 != dv && 0 != du) continue;
+
+        const Index v_in = v + dv;
+        const Index u_in = u + du;
+        if (v_in >= 0 && v_in < x.rows() && u_in >= 0 && u_in < x.cols() && !x(v_in, u_in))
+        {
+            out(v, u) = false;
+        }
+    }
+    return out;
+}
+
+TEST(Morphology, dilate)
+{
+    ImArray<bool> x
+    {
+        {0, 0, 0, 0, 0},
+        {0, 0, 0, 0, 0},
+        {0, 0, 1, 0, 0},
+        {0, 0, 0, 0, 0},
+        {0, 0, 0, 0, 1},
+    };
+    const SparseImage<bool> sparse_image(x);
+
+    ImArray<bool> rect_expected
+    {
+        {0, 0, 0, 0, 0},
+        {0, 1, 1, 1, 0},
+        {0, 1, 1, 1, 0},
+        {0, 1, 1, 1, 1},
+        {0, 0, 0, 1, 1},
+    };
+    const ImArray<bool> rect = to_dense(dilate(sparse_image, StructuringElement::rect(3, 3)));
+    EXPECT_TRUE((rect == rect_expected).all())
+        << rect;
+
+    ImArray<bool> cross_expected
+    {
+        {0, 0, 0, 0, 0},
+        {0, 0, 1, 0, 0},
+        {0, 1, 1, 1, 0},
+        {0, 0, 1, 0, 1},
+        {0, 0, 0, 1, 1},
+    };
+    const ImArray<bool> cross = to_dense(dilate(sparse_image, StructuringElement::cross(3, 3)));
+    EXPECT_TRUE((cross == cross_expected).all())
+        << cross;
+}
+
+TEST(Morphology, erode__border_is_neutral)
+{
+    ImArray<bool> x = ImArray<bool>::Constant(4, 5, true);
+    x(2, 2) = false;
+    const SparseImage<bool> sparse_image(x);
+
+    ImArray<bool> expected
+    {
+        {1, 1, 1, 1, 1},
+        {1, 0, 0, 0, 1},
+        {1, 0, 0, 0, 1},
+        {1, 0, 0, 0, 1},
+    };
+    const ImArray<bool> out = to_dense(erode(sparse_image, StructuringElement::rect(3, 3)));
+    EXPECT_TRUE((out == expected).all())
+        << out;
+
+    const ImArray<bool> full = ImArray<bool>::Constant(4, 5, true);
+    EXPECT_TRUE(to_dense(erode(SparseImage<bool>(full), StructuringElement::cross(5, 3))).all());
+    EXPECT_TRUE(to_dense(closing(SparseImage<bool>(full), StructuringElement::rect(3, 3))).all());
+}
+
+TEST(Morphology, opening_and_closing_bound_the_mask)
+{
+    const ImArray<bool> x = random_mask(41, 57, 0.4f);
+    const SparseImage<bool> sparse_image(x);
+
+    for (auto make : {&StructuringElement::rect, &StructuringElement::cross})
+    for (auto [width, height] : {std::pair<Index, Index>{3, 3}, {7, 5}, {15, 9}})
+    {
+        const StructuringElement element = make(width, height);
+        SCOPED_TRACE(testing::Message() << static_cast<int>(element.shape) << " " << width << "x" << height);
+
+        // closing(x) contains x, and opening(x) is contained in x
+        EXPECT_FALSE((x && !to_dense(closing(sparse_image, element))).any());
+        EXPECT_FALSE((to_dense(opening(sparse_image, element)) && !x).any());
+    }
+}
+
+TEST(Morphology, matches_reference)
+{
+    const ImArray<bool> x = random_mask(41, 57, 0.4f);
+    const SparseImage<bool> sparse_image(x);
+
+    for (auto make : {&StructuringElement::rect, &StructuringElement::cross})
+    for (auto [width, height] : {std::pair<Index, Index>{1, 1}, {3, 1}, {1, 5}, {3, 3}, {7, 5}, {11, 13}, {71, 3}})
+    {
+        const StructuringElement element = make(width, height);
+        SCOPED_TRACE(testing::Message() << static_cast<int>(element.shape) << " " << width << "x" << height);
+
+        const ImArray<bool> dilated = dilate_reference(x, element);
+        const ImArray<bool> eroded = erode_reference(x, element);
+
+        EXPECT_TRUE((to_dense(dilate(sparse_image, element)) == dilated).all());
+        EXPECT_TRUE((to_dense(erode(sparse_image, element)) == eroded).all());
+        EXPECT_TRUE((to_dense(opening(sparse_image, element)) == dilate_reference(eroded, element)).all());
+        EXPECT_TRUE((to_dense(closing(sparse_image, element)) == erode_reference(dilated, element)).all());
+    }
+}
+
+TEST(Morphology, encodes_like_sparse_image)
+{
+    const ImArray<bool> x = random_mask(20, 30, 0.7f);
+    const SparseImage<bool> dilated = dilate(SparseImage<bool>(x), StructuringElement::rect(5, 3));
+    const SparseImage<bool> expected(dilate_reference(x, StructuringElement::rect(5, 3)));
+
+    EXPECT_THAT(dilated.encoded_runs(), ::testing::ElementsAreArray(expected.encoded_runs()));
+
+    const ImArray<bool> zeros = ImArray<bool>::Constant(3, 4, false);
+    const SparseImage<bool> eroded = erode(SparseImage<bool>(zeros), StructuringElement::cross(3, 3));
+    EXPECT_THAT(eroded.encoded_runs(), ::testing::ElementsAreArray(SparseImage<bool>(zeros).encoded_runs()));
+}
+
+TEST(Morphology, structuring_element_sizes)
+{
+    EXPECT_THROW(StructuringElement::rect(2, 3), std::runtime_error);
+    EXPECT_THROW(StructuringElement::cross(3, 0), std::runtime_error);
+
+    const StructuringElement element = StructuringElement::cross(5, 3);
+    EXPECT_EQ(element.shape, StructuringElement::Shape::CROSS);
+    EXPECT_EQ(element.half_width, 2);
+    EXPECT_EQ(element.half_height, 1);
+}
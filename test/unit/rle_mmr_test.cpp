@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "codec/rle_v2.h"
+#include "codec/rle_mmr.h"
+#include <span>
+#include <Eigen/Dense>
+
+using Eigen::Array;
+using Eigen::Dynamic;
+using Eigen::Matrix;
+using Eigen::RowMajor;
+
+#define DISP(x) std::cout << #x << ":\n" << x << std::endl;
+
+using namespace rle::mmr;
+
+TEST(rle_mmr, encode_decode__all_zeros)
+{
+    std::vector<uint8_t> x(5000);
+
+    std::vector<uint8_t> buff(max_encoded_size(x.size(), 100));
+    std::span<uint8_t> encoded = encode(x, 100, buff);
+    EXPECT_LE(encoded.size(), 7u);
+
+    std::vector<uint8_t> x_decoded(x.size(), 1);
+    decode(encoded, 100, x_decoded);
+
+    EXPECT_EQ(x_decoded, x);
+}
+
+TEST(rle_mmr, encode_decode__blobs)
+{
+    const int height = 480;
+    const int width = 640;
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x(height, width);
+    for (int v = 0; v < height; v++)
+    {
+        for (int u = 0; u < width; u++)
+        {
+            const double du = (u - 320) / 200.0;
+            const double dv = (v - 240) / 150.0;
+            const double dv2 = (v - 100) / 40.0;
+            x(v, u) = du * du + dv * dv < 1 || (u > 500 && dv2 * dv2 < 1) || (u + v) % 97 == 0;
+        }
+    }
+    x.block(200, 250, 80, 140) = 0;
+
+    std::vector<uint8_t> buff(max_encoded_size(x.size(), width));
+    std::span<uint8_t> encoded = encode(std::span(x.data(), x.size()), width, buff);
+
+    std::vector<uint8_t> v2_buff(rle::v2::max_encoded_size(x.size()));
+    std::span<uint8_t> v2_encoded = rle::v2::encode(std::span(x.data(), x.size()), v2_buff);
+    DISP(encoded.size());
+    DISP(v2_encoded.size());
+    EXPECT_LT(2 * encoded.size(), v2_encoded.size());
+
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x_decoded;
+    x_decoded.resizeLike(x);
+
+    decode(encoded, width, std::span(x_decoded.data(), x_decoded.size()));
+
+    EXPECT_TRUE((x == x_decoded).all());
+}
+
+TEST(rle_mmr, encode_decode__noise)
+{
+    for (float threshold : {-0.9f, 0.0f, 0.9f})
+    {
+        Array<float, Dynamic, Dynamic> rand_x = Matrix<float, Dynamic, Dynamic>::Random(301, 257);
+        Array<uint8_t, Dynamic, Dynamic, RowMajor> x = (rand_x > threshold).cast<uint8_t>();
+
+        std::vector<uint8_t> buff(max_encoded_size(x.size(), x.cols()));
+        std::span<uint8_t> encoded = encode(std::span(x.data(), x.size()), x.cols(), buff);
+
+        Array<uint8_t, Dynamic, Dynamic, RowMajor> x_decoded;
+        x_decoded.resizeLike(x);
+
+        decode(encoded, x.cols(), std::span(x_decoded.data(), x_decoded.size()));
+
+        EXPECT_TRUE((x == x_decoded).all());
+    } // end for threshold
+}
+
+TEST(rle_mmr, encode_decode__narrow)
+{
+    for (size_t width : {1, 2, 3, 5})
+    {
+        std::vector<uint8_t> x(width * 40);
+        for (size_t i = 0; i < x.size(); i++) x[i] = (i * 7 + i / 3) % 5 < 2;
+
+        std::vector<uint8_t> buff(max_encoded_size(x.size(), width));
+        std::span<uint8_t> encoded = encode(x, width, buff);
+
+        std::vector<uint8_t> x_decoded(x.size());
+        decode(encoded, width, x_decoded);
+
+        EXPECT_EQ(x_decoded, x);
+    } // end for width
+}
+
+TEST(rle_mmr, max_encoded_size)
+{
+    // Alternating rows of checkerboards are the worst case.
+    const size_t width = 101;
+    std::vector<uint8_t> x(width * 50);
+    for (size_t i = 0; i < x.size(); i++) x[i] = (i % width + i / width) % 2;
+
+    std::vector<uint8_t> buff(max_encoded_size(x.size(), width));
+    std::span<uint8_t> encoded = encode(x, width, buff);
+
+    EXPECT_LE(encoded.size(), max_encoded_size(x.size(), width));
+
+    std::vector<uint8_t> x_decoded(x.size());
+    decode(encoded, width, x_decoded);
+    EXPECT_EQ(x_decoded, x);
+}
+
+TEST(rle_mmr, encode__bad_width)
+{
+    std::vector<uint8_t> x(100);
+    std::vector<uint8_t> buff(100);
+    EXPECT_THROW(encode(x, 0, buff), std::runtime_error);
+    EXPECT_THROW(encode(x, 30, buff), std::runtime_error);
+}
+
+TEST(rle_mmr, decode__truncated)
+{
+    Array<float, Dynamic, Dynamic> rand_x = Matrix<float, Dynamic, Dynamic>::Random(100, 100);
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x = (rand_x > 0.5).cast<uint8_t>();
+
+    std::vector<uint8_t> buff(max_encoded_size(x.size(), 100));
+    std::span<uint8_t> encoded = encode(std::span(x.data(), x.size()), 100, buff);
+
+    std::vector<uint8_t> x_decoded(x.size());
+    EXPECT_THROW(decode(encoded.first(encoded.size() - 2), 100, x_decoded), std::runtime_error);
+}
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "codec/rle_multi.h"
+#include <span>
+#include <Eigen/Dense>
+
+using Eigen::Array;
+using Eigen::Dynamic;
+using Eigen::RowMajor;
+using ::testing::ElementsAre;
+
+using namespace rle::multi;
+
+TEST(rle_multi, encode__u8)
+{
+    std::vector<uint8_t> x{0, 0, 0, 3, 3, 200, 0};
+
+    std::vector<uint8_t> buff(max_encoded_size<uint8_t>(x.size()));
+    std::span<uint8_t> encoded = encode(x, buff);
+
+    ASSERT_THAT(encoded, ElementsAre(0, 3, 3, 2, 0xc8, 0x01, 1, 0, 1));
+}
+
+TEST(rle_multi, encode_decode__u8)
+{
+    std::vector<uint8_t> x(1000);
+    for (size_t i = 0; i < x.size(); i++) x[i] = (i / 37) % 5 == 0 ? 255 : i / 100;
+
+    std::vector<uint8_t> buff(max_encoded_size<uint8_t>(x.size()));
+    std::span<uint8_t> encoded = encode(x, buff);
+
+    std::vector<uint8_t> x_decoded(x.size());
+    std::span<uint8_t> decoded = decode(encoded, x_decoded);
+
+    EXPECT_EQ(decoded.size(), x.size());
+    EXPECT_EQ(x_decoded, x);
+}
+
+TEST(rle_multi, encode_decode__u16)
+{
+    Array<uint16_t, Dynamic, Dynamic, RowMajor> x(480, 640);
+    x.setConstant(0);
+    x.block(10, 10, 100, 300) = 7;
+    x.block(50, 200, 300, 100) = 1000;
+    x.block(400, 0, 80, 640) = 65535;
+    x(0, 0) = 3;
+
+    std::vector<uint8_t> buff(max_encoded_size<uint16_t>(x.size()));
+    std::span<uint8_t> encoded = encode(std::span<const uint16_t>(x.data(), x.size()), buff);
+
+    Array<uint16_t, Dynamic, Dynamic, RowMajor> x_decoded;
+    x_decoded.resizeLike(x);
+    decode(encoded, std::span(x_decoded.data(), x_decoded.size()));
+
+    EXPECT_TRUE((x == x_decoded).all());
+}
+
+TEST(rle_multi, max_encoded_size)
+{
+    std::vector<uint16_t> x(101);
+    for (size_t i = 0; i < x.size(); i++) x[i] = i % 2 ? 65535 : 0;
+
+    std::vector<uint8_t> buff(max_encoded_size<uint16_t>(x.size()));
+    std::span<uint8_t> encoded = encode(x, buff);
+
+    EXPECT_LE(encoded.size(), buff.size());
+}
+
+TEST(rle_multi, decode__value_out_of_range)
+{
+    std::vector<uint16_t> x(10, 300);
+
+    std::vector<uint8_t> buff(max_encoded_size<uint16_t>(x.size()));
+    std::span<uint8_t> encoded = encode(x, buff);
+
+    std::vector<uint8_t> x_decoded(x.size());
+    EXPECT_THROW(decode(encoded, x_decoded), std::runtime_error);
+}
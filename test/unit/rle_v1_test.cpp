@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include "codec/rle_v1.h"
+#include "test_util.h"
+#include <algorithm>
 #include <span>
 #include <Eigen/Dense>
 
@@ -93,4 +95,27 @@ TEST(rle, encode_decode_sparse_small)
     decode(rle, std::span(x_decoded.data(), x_decoded.size()));
 
     EXPECT_TRUE((x == x_decoded).all());
-}
\ No newline at end of file
+}
+
+TEST(rle, encode_decode__bit_packed)
+{
+    Array<float, Dynamic, Dynamic> rand_x = Matrix<float, Dynamic, Dynamic>::Random(480, 650);
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x = (rand_x > 0.95).cast<uint8_t>();
+    x.block(100, 10, 50, 600) = 1;
+
+    const std::vector<uint64_t> packed = pack(x);
+    const size_t stride = codec::bit_packed::row_stride(x.cols());
+
+    // The packed encoder produces the same stream as the byte encoder.
+    std::vector<uint8_t> buff(10e6);
+    std::span<uint8_t> encoded = encode(codec::bit_packed::ConstMask{packed, size_t(x.cols()), size_t(x.rows()), stride}, buff);
+
+    std::vector<uint8_t> byte_buff(10e6);
+    std::span<uint8_t> byte_encoded = encode(std::span(x.data(), x.size()), byte_buff);
+    EXPECT_TRUE(std::ranges::equal(encoded, byte_encoded));
+
+    std::vector<uint64_t> decoded(packed.size());
+    decode(encoded, codec::bit_packed::Mask{decoded, size_t(x.cols()), size_t(x.rows()), stride});
+
+    EXPECT_EQ(decoded, packed);
+}
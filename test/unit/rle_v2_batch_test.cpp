@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "codec/rle_v2.h"
+#include "codec/rle_v2_batch.h"
+#include <algorithm>
+#include <span>
+#include <vector>
+
+using namespace rle::v2;
+
+static std::vector<std::vector<uint8_t>> make_masks(size_t n_masks)
+{
+    std::vector<std::vector<uint8_t>> masks(n_masks);
+    for (size_t i = 0; i < n_masks; i++)
+    {
+        masks[i].resize((i % 13) * 37);
+        for (size_t j = 0; j < masks[i].size(); j++)
+        {
+            masks[i][j] = (j / (1 + i % 5) + i) % 3 == 0;
+        }
+    }
+    return masks;
+}
+
+TEST(rle_v2_batch, encode_decode)
+{
+    const std::vector<std::vector<uint8_t>> masks = make_masks(100);
+    const std::vector<std::span<const uint8_t>> data(masks.begin(), masks.end());
+
+    std::vector<uint8_t> arena(batch::max_encoded_size(data));
+    std::vector<size_t> offsets(data.size() + 1);
+    std::span<uint8_t> encoded = batch::encode(data, arena, offsets);
+    EXPECT_EQ(encoded.size(), offsets.back());
+
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        std::vector<uint8_t> buff(max_encoded_size(data[i].size()));
+        std::span<uint8_t> expected = encode(data[i], buff);
+        EXPECT_TRUE(std::ranges::equal(encoded.subspan(offsets[i], offsets[i + 1] - offsets[i]), expected)) << i;
+    }
+
+    std::vector<std::vector<uint8_t>> decoded(masks.size());
+    std::vector<std::span<uint8_t>> data_buffs;
+    for (size_t i = 0; i < masks.size(); i++)
+    {
+        decoded[i].resize(masks[i].size(), 2);
+        data_buffs.push_back(decoded[i]);
+    }
+    batch::decode(encoded, offsets, data_buffs);
+
+    EXPECT_EQ(decoded, masks);
+}
+
+TEST(rle_v2_batch, encode_decode__thread_pool)
+{
+    const std::vector<std::vector<uint8_t>> masks = make_masks(300);
+    const std::vector<std::span<const uint8_t>> data(masks.begin(), masks.end());
+
+    std::vector<uint8_t> arena(batch::max_encoded_size(data));
+    std::vector<size_t> offsets(data.size() + 1);
+    std::span<uint8_t> encoded = batch::encode(data, arena, offsets);
+
+    codec::ThreadPool pool(4);
+    std::vector<uint8_t> parallel_arena(arena.size());
+    std::vector<size_t> parallel_offsets(data.size() + 1);
+    std::span<uint8_t> parallel_encoded = batch::encode(data, parallel_arena, parallel_offsets, &pool);
+
+    EXPECT_EQ(parallel_offsets, offsets);
+    EXPECT_TRUE(std::ranges::equal(parallel_encoded, encoded));
+
+    std::vector<std::vector<uint8_t>> decoded(masks.size());
+    std::vector<std::span<uint8_t>> data_buffs;
+    for (size_t i = 0; i < masks.size(); i++)
+    {
+        decoded[i].resize(masks[i].size());
+        data_buffs.push_back(decoded[i]);
+    }
+    batch::decode(parallel_encoded, parallel_offsets, data_buffs, &pool);
+
+    EXPECT_EQ(decoded, masks);
+}
+
+TEST(rle_v2_batch, encode__arena_too_small)
+{
+    const std::vector<std::vector<uint8_t>> masks = make_masks(20);
+    const std::vector<std::span<const uint8_t>> data(masks.begin(), masks.end());
+
+    std::vector<uint8_t> arena(10);
+    std::vector<size_t> offsets(data.size() + 1);
+    EXPECT_THROW(batch::encode(data, arena, offsets), std::runtime_error);
+
+    codec::ThreadPool pool(2);
+    EXPECT_THROW(batch::encode(data, arena, offsets, &pool), std::runtime_error);
+}
+
+TEST(rle_v2_batch, bad_offsets)
+{
+    const std::vector<std::vector<uint8_t>> masks = make_masks(3);
+    const std::vector<std::span<const uint8_t>> data(masks.begin(), masks.end());
+
+    std::vector<uint8_t> arena(batch::max_encoded_size(data));
+    std::vector<size_t> offsets(data.size());
+    EXPECT_THROW(batch::encode(data, arena, offsets), std::runtime_error);
+
+    std::vector<size_t> bad_offsets{0, 1000, 2000, 3000};
+    std::vector<uint8_t> buff(10);
+    std::vector<std::span<uint8_t>> data_buffs(3, std::span<uint8_t>(buff));
+    EXPECT_THROW(batch::decode(arena, bad_offsets, data_buffs), std::runtime_error);
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "codec/rle_v2.h"
+#include "codec/rle_v2_framed.h"
+#include <algorithm>
+#include <span>
+#include <Eigen/Dense>
+
+using Eigen::Array;
+using Eigen::Dynamic;
+using Eigen::Matrix;
+using Eigen::RowMajor;
+
+using namespace rle::v2;
+
+TEST(rle_v2_framed, encode_decode)
+{
+    Array<float, Dynamic, Dynamic> rand_x = Matrix<float, Dynamic, Dynamic>::Random(1001, 640);
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x = (rand_x > 0.95).cast<uint8_t>();
+    x.block(100, 0, 300, 640) = 1;
+
+    const size_t band_size = 64 * x.cols();
+    std::vector<uint8_t> buff(framed::max_encoded_size(x.size(), band_size));
+    std::span<uint8_t> encoded = framed::encode(std::span(x.data(), x.size()), band_size, buff);
+
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x_decoded;
+    x_decoded.resizeLike(x);
+    std::span<uint8_t> decoded = framed::decode(encoded, std::span(x_decoded.data(), x_decoded.size()));
+
+    EXPECT_EQ(decoded.size(), x.size());
+    EXPECT_TRUE((x == x_decoded).all());
+}
+
+TEST(rle_v2_framed, encode_decode__thread_pool)
+{
+    Array<float, Dynamic, Dynamic> rand_x = Matrix<float, Dynamic, Dynamic>::Random(1001, 640);
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x = (rand_x > 0.95).cast<uint8_t>();
+
+    const size_t band_size = 16 * x.cols();
+    std::vector<uint8_t> buff(framed::max_encoded_size(x.size(), band_size));
+    std::span<uint8_t> encoded = framed::encode(std::span(x.data(), x.size()), band_size, buff);
+
+    codec::ThreadPool pool(4);
+    std::vector<uint8_t> parallel_buff(buff.size());
+    std::span<uint8_t> parallel_encoded = framed::encode(std::span(x.data(), x.size()), band_size, parallel_buff, &pool);
+
+    EXPECT_TRUE(std::ranges::equal(encoded, parallel_encoded));
+
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x_decoded;
+    x_decoded.resizeLike(x);
+    framed::decode(parallel_encoded, std::span(x_decoded.data(), x_decoded.size()), &pool);
+
+    EXPECT_TRUE((x == x_decoded).all());
+}
+
+TEST(rle_v2_framed, band_start_values)
+{
+    // Two bands of 4 pixels; the second one starts with a one.
+    std::vector<uint8_t> x{0, 0, 1, 1, 1, 1, 0, 0};
+
+    std::vector<uint8_t> buff(framed::max_encoded_size(x.size(), 4));
+    std::span<uint8_t> encoded = framed::encode(x, 4, buff);
+
+    // n_pixels, band_size, offsets, start values, streams.
+    ASSERT_THAT(encoded, ::testing::ElementsAre(
+        8, 4,
+        0, 0, 0, 0, 2, 0, 0, 0,
+        0, 1,
+        2, 2,
+        2, 2));
+}
+
+TEST(rle_v2_framed, decode__buffer_too_small)
+{
+    std::vector<uint8_t> x(100);
+    std::vector<uint8_t> buff(framed::max_encoded_size(x.size(), 10));
+    std::span<uint8_t> encoded = framed::encode(x, 10, buff);
+
+    std::vector<uint8_t> x_decoded(99);
+    EXPECT_THROW(framed::decode(encoded, x_decoded), std::runtime_error);
+}
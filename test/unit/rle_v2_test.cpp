@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include "codec/rle_v2.h"
+#include "test_util.h"
+#include <algorithm>
+#include <bit>
 #include <span>
 #include <Eigen/Dense>
 
@@ -54,6 +57,55 @@ TEST(rle_v2, encode__a_u8_2x3)
     ASSERT_THAT(encoded, ElementsAre(0, 1, 3, 1, 1));
 }
 
+TEST(rle_v2, encode__runs_across_simd_blocks)
+{
+    std::vector<uint8_t> x(100);
+    x[31] = 1;
+    x[32] = 1;
+    x[33] = 1;
+    x[64] = 1;
+
+    std::vector<uint8_t> buff(1024);
+    std::span<uint8_t> encoded = encode(std::span(x.data(), x.size()), buff);
+
+    ASSERT_THAT(encoded, ElementsAre(31, 3, 30, 1, 35));
+}
+
+TEST(rle_v2, encode__long_runs)
+{
+    std::vector<uint8_t> x(1000, 1);
+    std::fill(x.begin() + 300, x.end(), 0);
+
+    std::vector<uint8_t> buff(1024);
+    std::span<uint8_t> encoded = encode(std::span(x.data(), x.size()), buff);
+
+    ASSERT_THAT(encoded, ElementsAre(0, 0xac, 0x02, 0xbc, 0x05));
+}
+
+TEST(rle_v2, encoded_size)
+{
+    std::vector<uint8_t> x(1000, 1);
+    std::fill(x.begin() + 300, x.end(), 0);
+    x[999] = 1;
+
+    std::vector<uint8_t> buff(rle::v2::max_encoded_size(x.size()));
+    std::span<uint8_t> encoded = encode(std::span(x.data(), x.size()), buff);
+
+    EXPECT_EQ(encoded_size(x), encoded.size());
+    EXPECT_EQ(encoded_size(std::vector<uint8_t>{}), 1);
+}
+
+TEST(rle_v2, max_encoded_size)
+{
+    std::vector<uint8_t> x(1001);
+    for (size_t i = 0; i < x.size(); i += 2) x[i] = 1;
+
+    std::vector<uint8_t> buff(max_encoded_size(x.size()));
+    std::span<uint8_t> encoded = encode(std::span(x.data(), x.size()), buff);
+
+    EXPECT_EQ(encoded.size(), max_encoded_size(x.size()));
+}
+
 TEST(rle_v2, encode_decode)
 {
     Array<float, Dynamic, Dynamic> rand_x = Matrix<float, Dynamic, Dynamic>::Random(2048, 2000);
@@ -117,4 +169,143 @@ TEST(rle_v2, encode_decode_sparse_small)
     decode(encoded, std::span(x_decoded.data(), x_decoded.size()));
 
     EXPECT_TRUE((x == x_decoded).all());
-}
\ No newline at end of file
+}
+
+TEST(rle_v2, Encoder__matches_one_shot)
+{
+    Array<float, Dynamic, Dynamic> rand_x = Matrix<float, Dynamic, Dynamic>::Random(480, 640);
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x = (rand_x > 0.9).cast<uint8_t>();
+    x.block(100, 0, 200, 640) = 0;
+    x.block(300, 0, 20, 640) = 1;
+
+    std::vector<uint8_t> expected_buff(max_encoded_size(x.size()));
+    std::span<uint8_t> expected = encode(std::span(x.data(), x.size()), expected_buff);
+
+    for (const size_t chunk_size : {1, 7, 640, 640 * 13})
+    {
+        Encoder encoder;
+        std::vector<uint8_t> encoded;
+        std::vector<uint8_t> buff(max_encoded_size(chunk_size) + 4);
+        for (size_t i = 0; i < size_t(x.size()); i += chunk_size)
+        {
+            const size_t n = std::min<size_t>(chunk_size, x.size() - i);
+            std::span<uint8_t> out = encoder.push(std::span(x.data() + i, n), buff);
+            encoded.insert(encoded.end(), out.begin(), out.end());
+        }
+        std::span<uint8_t> out = encoder.finish(buff);
+        encoded.insert(encoded.end(), out.begin(), out.end());
+
+        EXPECT_TRUE(std::ranges::equal(encoded, expected)) << "chunk_size: " << chunk_size;
+    }
+}
+
+TEST(rle_v2, Decoder__matches_one_shot)
+{
+    Array<float, Dynamic, Dynamic> rand_x = Matrix<float, Dynamic, Dynamic>::Random(480, 640);
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x = (rand_x > 0.9).cast<uint8_t>();
+    x.block(300, 0, 20, 640) = 1;
+
+    std::vector<uint8_t> buff(max_encoded_size(x.size()));
+    std::span<uint8_t> encoded = encode(std::span(x.data(), x.size()), buff);
+
+    for (const size_t window_size : {1, 7, 640, 640 * 13})
+    {
+        Decoder decoder(encoded);
+        Array<uint8_t, Dynamic, Dynamic, RowMajor> x_decoded;
+        x_decoded.resizeLike(x);
+
+        size_t n_decoded = 0;
+        while (!decoder.done())
+        {
+            const size_t n = std::min<size_t>(window_size, x.size() - n_decoded);
+            n_decoded += decoder.pull(std::span(x_decoded.data() + n_decoded, n)).size();
+        }
+
+        EXPECT_EQ(n_decoded, x.size());
+        EXPECT_TRUE((x == x_decoded).all()) << "window_size: " << window_size;
+    }
+}
+
+TEST(rle_v2, encode_decode__bit_packed)
+{
+    Array<float, Dynamic, Dynamic> rand_x = Matrix<float, Dynamic, Dynamic>::Random(480, 650);
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x = (rand_x > 0.95).cast<uint8_t>();
+    x.block(100, 10, 50, 600) = 1;
+
+    const std::vector<uint64_t> packed = pack(x);
+    const size_t stride = codec::bit_packed::row_stride(x.cols());
+
+    // The packed encoder produces the same stream as the byte encoder.
+    std::vector<uint8_t> buff(10e6);
+    std::span<uint8_t> encoded = encode(codec::bit_packed::ConstMask{packed, size_t(x.cols()), size_t(x.rows()), stride}, buff);
+
+    std::vector<uint8_t> byte_buff(10e6);
+    std::span<uint8_t> byte_encoded = encode(std::span(x.data(), x.size()), byte_buff);
+    EXPECT_TRUE(std::ranges::equal(encoded, byte_encoded));
+
+    std::vector<uint64_t> decoded(packed.size());
+    decode(encoded, codec::bit_packed::Mask{decoded, size_t(x.cols()), size_t(x.rows()), stride});
+
+    EXPECT_EQ(decoded, packed);
+}
+
+TEST(rle_v2, stats)
+{
+    std::vector<uint8_t> x{1, 1, 0, 0, 0, 1};
+
+    std::vector<uint8_t> buff(max_encoded_size(x.size()));
+    std::span<uint8_t> encoded = encode(x, buff);
+
+    const Stats s = stats(encoded);
+    EXPECT_EQ(s.n_runs, 3u);
+    EXPECT_EQ(s.n_one_runs, 2u);
+    EXPECT_EQ(s.n_pixels, 6u);
+    EXPECT_EQ(s.n_ones, 3u);
+    EXPECT_EQ(s.encoded_size, 4u);
+    EXPECT_EQ(s.run_length_histogram[1], 1u);
+    EXPECT_EQ(s.run_length_histogram[2], 2u);
+    EXPECT_DOUBLE_EQ(s.bytes_per_run(), 4.0 / 3);
+    EXPECT_DOUBLE_EQ(s.bits_per_pixel(), 8 * 4.0 / 6);
+}
+
+TEST(rle_v2, stats__random)
+{
+    Array<float, Dynamic, Dynamic> rand_x = Matrix<float, Dynamic, Dynamic>::Random(480, 650);
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x = (rand_x > 0.9).cast<uint8_t>();
+    x.block(100, 0, 50, 650) = 1;
+
+    std::vector<uint8_t> buff(max_encoded_size(x.size()));
+    std::span<uint8_t> encoded = encode(std::span(x.data(), x.size()), buff);
+
+    size_t n_runs = 1;
+    for (Eigen::Index i = 1; i < x.size(); i++) n_runs += x.data()[i] != x.data()[i - 1];
+
+    const Stats s = stats(encoded);
+    EXPECT_EQ(s.n_runs, n_runs);
+    EXPECT_EQ(s.n_pixels, size_t(x.size()));
+    EXPECT_EQ(s.n_ones, size_t(x.cast<int>().sum()));
+    EXPECT_EQ(s.encoded_size, encoded.size());
+    EXPECT_EQ(s.run_length_histogram[std::bit_width(50u * 650u)], 1u);
+
+    size_t n_histogram = 0;
+    for (size_t count : s.run_length_histogram) n_histogram += count;
+    EXPECT_EQ(n_histogram, n_runs);
+
+    Stats total{};
+    total += s;
+    total += s;
+    EXPECT_EQ(total.n_runs, 2 * n_runs);
+    EXPECT_EQ(total.n_pixels, 2 * s.n_pixels);
+    EXPECT_DOUBLE_EQ(total.bits_per_pixel(), s.bits_per_pixel());
+}
+
+TEST(rle_v2, append_run)
+{
+    std::vector<uint8_t> buff;
+    append_run(buff, 0);
+    append_run(buff, 127);
+    append_run(buff, 300);
+    append_run(buff, UINT32_MAX);
+
+    EXPECT_THAT(buff, ElementsAre(0, 127, 0xac, 0x02, 0xff, 0xff, 0xff, 0xff, 0x0f));
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "codec/rle_v3.h"
+#include <span>
+#include <Eigen/Dense>
+
+using Eigen::Array;
+using Eigen::Dynamic;
+using Eigen::Matrix;
+using Eigen::Vector;
+using Eigen::RowMajor;
+using ::testing::ElementsAre;
+
+using namespace rle::v3;
+
+TEST(rle_v3, encode__all_zeros)
+{
+    std::vector<uint8_t> x(5);
+
+    std::vector<uint8_t> buff(max_encoded_size(x.size()));
+    std::span<uint8_t> encoded = encode(x, buff);
+
+    // 1 run, control byte, run length.
+    ASSERT_THAT(encoded, ElementsAre(1, 0x00, 5));
+}
+
+TEST(rle_v3, encode__v_u8_10)
+{
+    Vector<uint8_t, Dynamic> x(10);
+    x.setConstant(0);
+
+    x(0) = 1;
+    x(3) = 1;
+
+    std::vector<uint8_t> buff(max_encoded_size(x.size()));
+    std::span<uint8_t> encoded = encode(std::span(x.data(), x.size()), buff);
+
+    ASSERT_THAT(encoded, ElementsAre(5, 0x00, 0x00, 0, 1, 2, 1, 6));
+}
+
+TEST(rle_v3, encode__multi_byte_lengths)
+{
+    std::vector<uint8_t> x(70000);
+    std::fill(x.begin() + 300, x.end(), 1);
+
+    std::vector<uint8_t> buff(max_encoded_size(x.size()));
+    std::span<uint8_t> encoded = encode(x, buff);
+
+    // Runs of 300 (2 bytes) and 69700 (3 bytes).
+    ASSERT_THAT(encoded, ElementsAre(2, 0b1001, 0x2c, 0x01, 0x44, 0x10, 0x01));
+}
+
+TEST(rle_v3, encode_decode)
+{
+    Array<float, Dynamic, Dynamic> rand_x = Matrix<float, Dynamic, Dynamic>::Random(2048, 2000);
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x = (rand_x > 0.95).cast<uint8_t>();
+    x.block(500, 500, 200, 100) = 1;
+    x.block(1000, 0, 900, 2000) = 0;
+
+    std::vector<uint8_t> buff(max_encoded_size(x.size()));
+    std::span<uint8_t> encoded = encode(std::span(x.data(), x.size()), buff);
+
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x_decoded;
+    x_decoded.resizeLike(x);
+
+    decode(encoded, std::span(x_decoded.data(), x_decoded.size()));
+
+    EXPECT_TRUE((x == x_decoded).all());
+}
+
+TEST(rle_v3, max_encoded_size)
+{
+    std::vector<uint8_t> x(1001);
+    for (size_t i = 0; i < x.size(); i += 2) x[i] = 1;
+
+    std::vector<uint8_t> buff(max_encoded_size(x.size()));
+    std::span<uint8_t> encoded = encode(x, buff);
+
+    EXPECT_LE(encoded.size(), max_encoded_size(x.size()));
+}
+
+TEST(rle_v3, decode__truncated)
+{
+    std::vector<uint8_t> x(1000);
+    x[10] = 1;
+
+    std::vector<uint8_t> buff(max_encoded_size(x.size()));
+    std::span<uint8_t> encoded = encode(x, buff);
+
+    std::vector<uint8_t> x_decoded(x.size());
+    EXPECT_THROW(decode(encoded.first(encoded.size() - 1), x_decoded), std::runtime_error);
+}
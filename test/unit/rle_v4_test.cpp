@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "codec/rle_v2.h"
+#include "codec/rle_v4.h"
+#include <span>
+#include <Eigen/Dense>
+
+using Eigen::Array;
+using Eigen::Dynamic;
+using Eigen::Matrix;
+using Eigen::RowMajor;
+
+#define DISP(x) std::cout << #x << ":\n" << x << std::endl;
+
+using namespace rle::v4;
+
+TEST(rle_v4, encode_decode__all_zeros)
+{
+    std::vector<uint8_t> x(5000);
+
+    std::vector<uint8_t> buff(max_encoded_size(x.size()));
+    std::span<uint8_t> encoded = encode(x, buff);
+
+    std::vector<uint8_t> x_decoded(x.size(), 1);
+    decode(encoded, x_decoded);
+
+    EXPECT_EQ(x_decoded, x);
+}
+
+TEST(rle_v4, encode_decode)
+{
+    Array<float, Dynamic, Dynamic> rand_x = Matrix<float, Dynamic, Dynamic>::Random(2048, 2000);
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x = (rand_x > 0.95).cast<uint8_t>();
+    x.block(500, 500, 200, 100) = 1;
+    x.block(1000, 0, 900, 2000) = 0;
+
+    std::vector<uint8_t> buff(max_encoded_size(x.size()));
+    std::span<uint8_t> encoded = encode(std::span(x.data(), x.size()), buff);
+
+    std::vector<uint8_t> v2_buff(rle::v2::max_encoded_size(x.size()));
+    std::span<uint8_t> v2_encoded = rle::v2::encode(std::span(x.data(), x.size()), v2_buff);
+    DISP(encoded.size());
+    DISP(v2_encoded.size());
+    EXPECT_LT(encoded.size(), v2_encoded.size());
+
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x_decoded;
+    x_decoded.resizeLike(x);
+
+    decode(encoded, std::span(x_decoded.data(), x_decoded.size()));
+
+    EXPECT_TRUE((x == x_decoded).all());
+}
+
+TEST(rle_v4, encode_decode__long_runs)
+{
+    // Run lengths that need up to 31 verbatim bits.
+    std::vector<uint8_t> x(3'000'000);
+    std::fill(x.begin() + 17, x.begin() + 65553, 1);
+    std::fill(x.begin() + 2'000'000, x.end(), 1);
+
+    std::vector<uint8_t> buff(max_encoded_size(x.size()));
+    std::span<uint8_t> encoded = encode(x, buff);
+
+    std::vector<uint8_t> x_decoded(x.size());
+    decode(encoded, x_decoded);
+
+    EXPECT_EQ(x_decoded, x);
+}
+
+TEST(rle_v4, max_encoded_size)
+{
+    std::vector<uint8_t> x(1001);
+    for (size_t i = 0; i < x.size(); i += 2) x[i] = 1;
+
+    std::vector<uint8_t> buff(max_encoded_size(x.size()));
+    std::span<uint8_t> encoded = encode(x, buff);
+
+    EXPECT_LE(encoded.size(), max_encoded_size(x.size()));
+}
+
+TEST(rle_v4, decode__truncated)
+{
+    Array<float, Dynamic, Dynamic> rand_x = Matrix<float, Dynamic, Dynamic>::Random(100, 100);
+    Array<uint8_t, Dynamic, Dynamic, RowMajor> x = (rand_x > 0.5).cast<uint8_t>();
+
+    std::vector<uint8_t> buff(max_encoded_size(x.size()));
+    std::span<uint8_t> encoded = encode(std::span(x.data(), x.size()), buff);
+
+    std::vector<uint8_t> x_decoded(x.size());
+    EXPECT_THROW(decode(encoded.first(encoded.size() - 2), x_decoded), std::runtime_error);
+}
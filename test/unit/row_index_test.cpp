@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <Eigen/Dense>
+#include "codec/rle_v2.h"
+#include "imgproc/row_index.h"
+#include "imgproc/sparse_image.h"
+#include <vector>
+
+using Eigen::Dynamic;
+using Eigen::Matrix;
+
+TEST(RowIndex, seek_points)
+{
+    // Runs: 3 zeros, 6 ones, 3 zeros in a 4x3 image
+    const std::vector<uint8_t> encoded_runs{3, 6, 3};
+    const RowIndex row_index(encoded_runs, 3, 4, 1);
+
+    ASSERT_EQ(row_index.entries().size(), 4u);
+    EXPECT_EQ(row_index.seek(0).offset, 0u);
+    EXPECT_EQ(row_index.seek(0).pixel, 0u);
+    EXPECT_EQ(row_index.seek(0).value, 0u);
+    EXPECT_EQ(row_index.seek(1).offset, 1u);
+    EXPECT_EQ(row_index.seek(1).pixel, 3u);
+    EXPECT_EQ(row_index.seek(1).value, 1u);
+    EXPECT_EQ(row_index.seek(2).offset, 1u);
+    EXPECT_EQ(row_index.seek(2).pixel, 3u);
+    EXPECT_EQ(row_index.seek(3).offset, 2u);
+    EXPECT_EQ(row_index.seek(3).pixel, 9u);
+    EXPECT_EQ(row_index.seek(3).value, 0u);
+}
+
+TEST(RowIndex, stride)
+{
+    ImArray<float> rand_x = Matrix<float, Dynamic, Dynamic>::Random(100, 70);
+    ImArray<bool> x = rand_x > 0.5f;
+
+    const SparseImage<bool> sparse_image(x);
+    const RowIndex row_index(sparse_image.encoded_runs(), x.cols(), x.rows(), 8);
+
+    EXPECT_EQ(row_index.stride(), 8);
+    EXPECT_EQ(row_index.entries().size(), 13u);
+    EXPECT_EQ(&row_index.seek(15), &row_index.entries()[1]);
+    for (const SeekPoint &seek_point : row_index.entries())
+    {
+        EXPECT_LE(seek_point.pixel, (&seek_point - row_index.entries().data()) * 8u * 70u);
+    }
+}
+
+TEST(RowIndex, padding)
+{
+    // The stream ends after row 0; the rest of the image is the padding run of ones.
+    const std::vector<uint8_t> encoded_runs{5};
+    const RowIndex row_index(encoded_runs, 5, 3, 1);
+
+    ASSERT_EQ(row_index.entries().size(), 3u);
+    EXPECT_EQ(row_index.seek(2).offset, 1u);
+    EXPECT_EQ(row_index.seek(2).pixel, 5u);
+    EXPECT_EQ(row_index.seek(2).value, 1u);
+}
+
+TEST(RowIndex, copy_move)
+{
+    const std::vector<uint8_t> encoded_runs{3, 6, 3};
+    RowIndex row_index(encoded_runs, 3, 4, 1);
+
+    const RowIndex copy = row_index;
+    EXPECT_NE(copy.entries().data(), row_index.entries().data());
+    EXPECT_EQ(copy.seek(3).pixel, 9u);
+
+    const RowIndex moved = std::move(row_index);
+    EXPECT_EQ(moved.seek(3).pixel, 9u);
+
+    const RowIndex wrapped(moved.entries(), 1);
+    const RowIndex wrapped_copy = wrapped;
+    EXPECT_EQ(wrapped_copy.entries().data(), moved.entries().data());
+}
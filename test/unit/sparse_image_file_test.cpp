@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <Eigen/Dense>
+#include "imgproc/sparse_image_file.h"
+#include "test_util.h"
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+
+using Eigen::Dynamic;
+using Eigen::Matrix;
+
+class SparseImageFileTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        path_ = unique_temp_path("sparse_image_file_test");
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(path_);
+    }
+
+    std::filesystem::path path_;
+};
+
+TEST_F(SparseImageFileTest, save_load)
+{
+    ImArray<float> rand_x = Matrix<float, Dynamic, Dynamic>::Random(301, 203);
+    ImArray<bool> x = rand_x > 0.8f;
+    const SparseImage<bool> sparse_image(x);
+
+    save_sparse_image(path_, sparse_image);
+    const SparseImageFile file(path_, true);
+
+    EXPECT_EQ(file.image().width(), x.cols());
+    EXPECT_EQ(file.image().height(), x.rows());
+    EXPECT_TRUE(file.row_index().empty());
+    EXPECT_TRUE(std::ranges::equal(file.image().encoded_runs(), sparse_image.encoded_runs()));
+
+    ImArray<bool> x_out(x.rows(), x.cols());
+    x_out.setConstant(0);
+    from_sparse_image<bool>(file.image(), x_out);
+
+    EXPECT_TRUE((x_out == x).all());
+}
+
+TEST_F(SparseImageFileTest, load__corrupt)
+{
+    ImArray<bool> x(20, 30);
+    x.setConstant(0);
+    x.block(5, 5, 10, 10) = 1;
+
+    save_sparse_image(path_, SparseImage<bool>(x));
+    {
+        std::fstream file(path_, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(sizeof(SparseImageFileHeader));
+        file.put(42);
+    }
+
+    // The payload is only read when verifying
+    EXPECT_NO_THROW(SparseImageFile(path_, false));
+    EXPECT_THROW(SparseImageFile(path_, true), std::runtime_error);
+}
+
+TEST_F(SparseImageFileTest, load__truncated)
+{
+    ImArray<bool> x(20, 30);
+    x.setConstant(1);
+
+    save_sparse_image(path_, SparseImage<bool>(x));
+    std::filesystem::resize_file(path_, std::filesystem::file_size(path_) - 1);
+
+    EXPECT_THROW(SparseImageFile(path_, false), std::runtime_error);
+
+    std::filesystem::resize_file(path_, 10);
+    EXPECT_THROW(SparseImageFile(path_, false), std::runtime_error);
+}
+
+TEST_F(SparseImageFileTest, load__bad_magic)
+{
+    std::ofstream(path_, std::ios::binary) << std::string(100, 'x');
+
+    EXPECT_THROW(SparseImageFile(path_, false), std::runtime_error);
+}
+
+TEST_F(SparseImageFileTest, load__missing)
+{
+    EXPECT_THROW(SparseImageFile(path_, false), std::runtime_error);
+}
+
+TEST_F(SparseImageFileTest, save_load__row_index)
+{
+    ImArray<float> rand_x = Matrix<float, Dynamic, Dynamic>::Random(101, 203);
+    ImArray<bool> x = rand_x > 0.8f;
+    SparseImage<bool> sparse_image(x);
+    sparse_image.build_row_index(8);
+
+    save_sparse_image(path_, sparse_image);
+    const SparseImageFile file(path_, true);
+
+    ASSERT_TRUE(file.image().has_row_index());
+    EXPECT_EQ(file.image().row_index().stride(), 8);
+    EXPECT_EQ(file.image().row_index().entries().size(), 13u);
+    EXPECT_EQ(file.header().row_index_stride, 8u);
+
+    // The index is used in place
+    EXPECT_EQ(static_cast<const void*>(file.image().row_index().entries().data()),
+              static_cast<const void*>(file.row_index().data()));
+
+    for (Eigen::Index v = 0; v < x.rows(); v += 7)
+    {
+        for (Eigen::Index u = 0; u < x.cols(); u += 11)
+        {
+            ASSERT_EQ(file.image().at(u, v), x(v, u));
+        }
+    }
+}
+
+TEST_F(SparseImageFileTest, load__corrupt_row_index)
+{
+    ImArray<bool> x = random_mask(40, 30, 0.8f);
+    SparseImage<bool> sparse_image(x);
+    sparse_image.build_row_index(8);
+    save_sparse_image(path_, sparse_image);
+
+    EXPECT_NO_THROW(SparseImageFile(path_, false));
+
+    // The row index ends the file. Entry 2 of 5 claims to start past the end of
+    // the image, so seeking to row 16 would underflow. The index is checked even
+    // when the file is not verified.
+    {
+        std::fstream file(path_, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(-static_cast<std::streamoff>(3 * sizeof(SeekPoint) - offsetof(SeekPoint, pixel)), std::ios::end);
+        const uint64_t pixel = 40 * 30 + 1;
+        file.write(reinterpret_cast<const char*>(&pixel), sizeof(pixel));
+    }
+
+    EXPECT_THROW(SparseImageFile(path_, false), std::runtime_error);
+}
+
+TEST(SparseImageFile, save__write_error)
+{
+    if (!std::filesystem::exists("/dev/full")) GTEST_SKIP() << "needs /dev/full";
+
+    // The file is small enough to stay buffered until the stream is closed.
+    ImArray<bool> x(4, 5);
+    x.setConstant(0);
+    x(1, 2) = 1;
+
+    EXPECT_THROW(save_sparse_image("/dev/full", SparseImage<bool>(x)), std::runtime_error);
+}
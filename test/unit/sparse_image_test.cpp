@@ -4,6 +4,8 @@
 #include "imgproc/sparse_image.h"
 #include "imgproc/cwise_binary_op.h"
 #include "imgproc/ops.h"
+#include "test_util.h"
+#include <memory>
 
 using Eigen::Array;
 using Eigen::Dynamic;
@@ -88,6 +90,262 @@ TEST(SparseImage, from_sparse_image)
     EXPECT_TRUE((x_out == x).all());
 }
 
+TEST(SparseImage, make_sparse_image)
+{
+    ImArray<float> x = Matrix<float, Dynamic, Dynamic>::Random(301, 203);
+
+    const SparseImage<bool> sparse_image = make_sparse_image(x, ops::unary::predicate::Greater<float>{0.8f});
+
+    EXPECT_EQ(sparse_image.width(), x.cols());
+    EXPECT_EQ(sparse_image.height(), x.rows());
+
+    ImArray<bool> x_out(x.rows(), x.cols());
+    x_out.setConstant(0);
+    from_sparse_image<bool>(sparse_image, x_out);
+
+    EXPECT_TRUE((x_out == (x > 0.8f)).all());
+}
+
+TEST(SparseImage, make_sparse_image__expression)
+{
+    // Column-major input, an expression rather than an array, and a mask
+    // ending in a run of ones.
+    Array<float, Dynamic, Dynamic> x = Matrix<float, Dynamic, Dynamic>::Random(40, 3000);
+    x.bottomRows(5) = 0.5f;
+
+    const ops::unary::predicate::InRange<float> pred{0.25f, 1.5f};
+    const SparseImage<bool> sparse_image = make_sparse_image(x * 2, pred);
+
+    ImArray<bool> x_out(x.rows(), x.cols());
+    x_out.setConstant(0);
+    from_sparse_image<bool>(sparse_image, x_out);
+
+    ImArray<bool> x_expected = pred(x * 2);
+    EXPECT_TRUE((x_out == x_expected).all());
+}
+
+TEST(SparseImage, stats)
+{
+    ImArray<bool> x(3, 4);
+    x.setConstant(0);
+    x(0, 1) = true;
+    x(1, 2) = true;
+    x(1, 3) = true;
+
+    const SparseImage<bool> sparse_image(x);
+    const rle::v2::Stats stats = sparse_image.stats();
+
+    EXPECT_EQ(stats.n_pixels, 12u);
+    EXPECT_EQ(stats.n_ones, 3u);
+    EXPECT_EQ(stats.n_runs, 5u);
+    EXPECT_EQ(stats.n_one_runs, 2u);
+}
+
+TEST(SparseImage, runs)
+{
+    ImArray<bool> x
+    {
+        {1, 1, 0, 0},
+        {0, 0, 0, 1},
+        {1, 1, 1, 1}
+    };
+
+    const SparseImage<bool> sparse_image(x);
+
+    std::vector<std::tuple<Eigen::Index, Eigen::Index, Eigen::Index, bool>> runs;
+    visit_runs(sparse_image, [&](Eigen::Index v, Eigen::Index u_begin, Eigen::Index u_end, bool value) {
+        runs.emplace_back(v, u_begin, u_end, value);
+    });
+
+    EXPECT_THAT(runs, ElementsAre(
+        std::make_tuple(0, 0, 2, true),
+        std::make_tuple(0, 2, 4, false),
+        std::make_tuple(1, 0, 3, false),
+        std::make_tuple(1, 3, 4, true),
+        std::make_tuple(2, 0, 4, true)));
+}
+
+TEST(SparseImage, runs__random)
+{
+    ImArray<float> rand_x = Matrix<float, Dynamic, Dynamic>::Random(97, 131);
+    ImArray<bool> x = rand_x > 0.7f;
+    x.block(10, 0, 20, 131) = true;
+    x.block(40, 0, 20, 131) = false;
+
+    const SparseImage<bool> sparse_image(x);
+
+    ImArray<uint8_t> x_out(x.rows(), x.cols());
+    x_out.setConstant(2);
+    Eigen::Index n_px = 0;
+    for (const RowRun &run : sparse_image.runs())
+    {
+        ASSERT_LT(run.u_begin, run.u_end);
+        x_out.row(run.v).segment(run.u_begin, run.u_end - run.u_begin) = run.value;
+        n_px += run.u_end - run.u_begin;
+    }
+
+    EXPECT_EQ(n_px, x.size());
+    EXPECT_TRUE((x_out == x.cast<uint8_t>()).all());
+}
+
+TEST(SparseImage, runs__padded)
+{
+    // The stream stops after a run of 5 ones; the rest of the image is zeros.
+    const std::vector<uint8_t> encoded_runs{1, 5};
+    const SparseImage<bool> sparse_image(3, 4, std::span<const uint8_t>(encoded_runs));
+
+    std::vector<std::tuple<Eigen::Index, Eigen::Index, Eigen::Index, bool>> runs;
+    visit_runs(sparse_image, [&](Eigen::Index v, Eigen::Index u_begin, Eigen::Index u_end, bool value) {
+        runs.emplace_back(v, u_begin, u_end, value);
+    });
+
+    EXPECT_THAT(runs, ElementsAre(
+        std::make_tuple(0, 0, 1, false),
+        std::make_tuple(0, 1, 3, true),
+        std::make_tuple(1, 0, 3, true),
+        std::make_tuple(2, 0, 3, false),
+        std::make_tuple(3, 0, 3, false)));
+}
+
+TEST(SparseImage, runs__empty)
+{
+    const SparseImage<bool> sparse_image(0, 4, std::span<const uint8_t>());
+    EXPECT_EQ(sparse_image.run_begin(), sparse_image.run_end());
+
+    const SparseImage<bool> sparse_image_2(4, 0, std::span<const uint8_t>());
+    EXPECT_EQ(sparse_image_2.run_begin(), sparse_image_2.run_end());
+}
+
+TEST(SparseImage, from_sparse_image__overwrites)
+{
+    ImArray<float> rand_x = Matrix<float, Dynamic, Dynamic>::Random(37, 53);
+    ImArray<bool> x = rand_x > 0.5f;
+
+    const SparseImage<bool> sparse_image(x);
+
+    // No need to clear the output first
+    ImArray<bool> x_out(x.rows(), x.cols());
+    x_out.setConstant(1);
+    from_sparse_image<bool>(sparse_image, x_out);
+
+    EXPECT_TRUE((x_out == x).all());
+
+    // Rows that are not contiguous
+    ImArray<bool> big(x.rows() + 2, x.cols() + 3);
+    big.setConstant(1);
+    from_sparse_image<bool>(sparse_image, big.block(1, 2, x.rows(), x.cols()));
+
+    EXPECT_TRUE((big.block(1, 2, x.rows(), x.cols()) == x).all());
+}
+
+TEST(SparseImage, from_sparse_image__roi)
+{
+    ImArray<float> rand_x = Matrix<float, Dynamic, Dynamic>::Random(37, 53);
+    ImArray<bool> x = rand_x > 0.5f;
+    x.block(5, 0, 10, 53) = true;
+
+    const SparseImage<bool> sparse_image(x);
+
+    for (auto [u0, v0, width, height] : {
+        std::array<Eigen::Index, 4>{0, 0, 53, 37},
+        std::array<Eigen::Index, 4>{10, 3, 20, 15},
+        std::array<Eigen::Index, 4>{52, 36, 1, 1},
+        std::array<Eigen::Index, 4>{0, 20, 53, 17}})
+    {
+        ImArray<bool> roi(height, width);
+        roi.setConstant(1);
+        from_sparse_image<bool>(sparse_image, u0, v0, roi);
+
+        EXPECT_TRUE((roi == x.block(v0, u0, height, width)).all()) << u0 << " " << v0;
+    }
+
+    // Into a block of a larger array
+    ImArray<bool> big(40, 60);
+    big.setConstant(1);
+    from_sparse_image<bool>(sparse_image, 10, 3, big.block(1, 2, 15, 20));
+
+    EXPECT_TRUE((big.block(1, 2, 15, 20) == x.block(3, 10, 15, 20)).all());
+    EXPECT_EQ(big.cast<int>().sum() - big.block(1, 2, 15, 20).cast<int>().sum(), 40 * 60 - 15 * 20);
+}
+
+TEST(SparseImage, row_begin_at)
+{
+    ImArray<float> rand_x = Matrix<float, Dynamic, Dynamic>::Random(61, 47);
+    ImArray<bool> x = rand_x > 0.6f;
+    x.block(20, 0, 15, 47) = true;
+
+    for (Eigen::Index stride : {1, 4, 16, 100})
+    {
+        SparseImage<bool> sparse_image(x);
+        sparse_image.build_row_index(stride);
+
+        for (Eigen::Index v = 0; v < x.rows(); v += 3)
+        {
+            for (Eigen::Index u = 0; u < x.cols(); u += 5)
+            {
+                ASSERT_EQ(sparse_image.at(u, v), x(v, u)) << u << " " << v << " " << stride;
+            }
+
+            // The runs from row_begin(v) are those of rows v onwards
+            const RowRun run = *sparse_image.row_begin(v);
+            EXPECT_EQ(run.v, v);
+            EXPECT_EQ(run.u_begin, 0);
+            EXPECT_EQ(run.value, x(v, 0));
+        }
+
+        ImArray<bool> rows(10, x.cols());
+        rows.setConstant(0);
+        for (const RowRun &run : sparse_image.runs(30, 40))
+        {
+            rows.row(run.v - 30).segment(run.u_begin, run.u_end - run.u_begin) = run.value;
+        }
+        EXPECT_TRUE((rows == x.middleRows(30, 10)).all());
+    } // end for stride
+}
+
+TEST(SparseImage, at__lazy_row_index)
+{
+    ImArray<bool> x(5, 4);
+    x.setConstant(0);
+    x(3, 2) = true;
+
+    const SparseImage<bool> sparse_image(x);
+    EXPECT_FALSE(sparse_image.has_row_index());
+    EXPECT_TRUE(sparse_image.at(2, 3));
+    EXPECT_FALSE(sparse_image.at(1, 3));
+    EXPECT_TRUE(sparse_image.has_row_index());
+}
+
+TEST(SparseImage, copy__outlives_source)
+{
+    const ImArray<bool> x = random_mask(30, 20, 0.5f);
+
+    auto source = std::make_unique<SparseImage<bool>>(x);
+    source->build_row_index(4);
+    SparseImage<bool> copy(*source);
+
+    SparseImage<bool> assigned = make_sparse_image(ImArray<float>::Zero(2, 2), ops::unary::predicate::Greater<float>{0.5f});
+    assigned = *source;
+    source.reset();
+
+    for (const SparseImage<bool> *image : {&copy, &assigned})
+    {
+        ImArray<bool> out(x.rows(), x.cols());
+        from_sparse_image<bool>(*image, out);
+        EXPECT_TRUE((out == x).all());
+
+        ImArray<bool> rows(5, x.cols());
+        from_sparse_image<bool>(*image, 0, 11, rows);
+        EXPECT_TRUE((rows == x.middleRows(11, 5)).all());
+    } // end for image
+
+    // Copies of images that don't own their runs share them.
+    const SparseImage<bool> owner(x);
+    const SparseImage<bool> view(owner.width(), owner.height(), owner.encoded_runs());
+    const SparseImage<bool> view_copy(view);
+    EXPECT_EQ(view_copy.encoded_runs().data(), owner.encoded_runs().data());
+}
+
 TEST(SparseImage, correlate)
 {
     ImArray<bool> x(3, 4);
@@ -150,6 +408,274 @@ TEST(SparseImage, correlate__upper_left_corner)
         << out;
 }
 
+TEST(SparseImage, correlate__lower_right_corner)
+{
+    ImArray<bool> x(3, 4);
+    x.setConstant(0);
+    x(2, 3) = 1;
+
+    SparseImage<bool> sparse_image(x);
+
+    ImArray<uint8_t> kernel
+    {
+        {1, 2, 3},
+        {4, 5, 6},
+        {7, 8, 9},
+    };
+
+    ImArray<uint8_t> out(3, 4);
+    out.setConstant(0);
+
+    correlate<uint8_t>(sparse_image, kernel, out);
+
+    ImArray<uint8_t> out_expected
+    {
+        {0, 0, 0, 0},
+        {0, 0, 1, 2},
+        {0, 0, 4, 5}
+    };
+
+    EXPECT_TRUE((out == out_expected).all())
+        << out;
+}
+
+template <typename T>
+static ImArray<T> correlate_reference(const ImArray<bool> &x, const ImArray<T> &kernel)
+{
+    using Eigen::Index;
+
+    ImArray<T> out = ImArray<T>::Zero(x.rows(), x.cols());
+    for (Index v = 0; v < x.rows(); ++v)
+    for (Index u = 0; u < x.cols(); ++u)
+    {
+        if (!x(v, u)) continue;
+
+        for (Index i = 0; i < kernel.rows(); ++i)
+        for (Index j = 0; j < kernel.cols(); ++j)
+        {
+            const Index v_out = v + i - kernel.rows() / 2;
+            const Index u_out = u + j - kernel.cols() / 2;
+            if (v_out >= 0 && v_out < x.rows() && u_out >= 0 && u_out < x.cols())
+            {
+                out(v_out, u_out) += kernel(i, j);
+            }
+        }
+    }
+    return out;
+}
+
+TEST(SparseImage, classify_kernel)
+{
+    ImArray<float> box = ImArray<float>::Constant(3, 5, 0.5f);
+    EXPECT_EQ(classify_kernel<float>(box), KernelKind::BOX);
+
+    Eigen::Array<float, Dynamic, 1> column{{1.0f, 4.0f, 6.0f, 4.0f, 1.0f}};
+    Eigen::Array<float, 1, Dynamic> row{{-1.0f, 0.0f, 1.0f}};
+    ImArray<float> separable = column.matrix() * row.matrix();
+    EXPECT_EQ(classify_kernel<float>(separable), KernelKind::SEPARABLE);
+
+    ImArray<int> general
+    {
+        {0, 1, 0},
+        {1, 1, 1},
+        {0, 1, 0},
+    };
+    EXPECT_EQ(classify_kernel<int>(general), KernelKind::GENERAL);
+
+    ImArray<int> integer_separable
+    {
+        {1, 2, 1},
+        {2, 4, 2},
+        {3, 6, 3},
+    };
+    EXPECT_EQ(classify_kernel<int>(integer_separable), KernelKind::SEPARABLE);
+}
+
+TEST(SparseImage, correlate__matches_reference)
+{
+    const ImArray<bool> x = random_mask(67, 91, 0.6f);
+    const SparseImage<bool> sparse_image(x);
+
+    ImArray<float> general = ImArray<float>::Random(5, 7);
+
+    Eigen::Array<float, Dynamic, 1> column{{1.0f, 4.0f, 6.0f, 4.0f, 1.0f}};
+    Eigen::Array<float, 1, Dynamic> row{{-1.0f, -2.0f, 0.0f, 2.0f, 1.0f, 0.5f, 0.25f}};
+    ImArray<float> separable = column.matrix() * row.matrix();
+
+    ImArray<float> box = ImArray<float>::Constant(9, 3, 0.25f);
+
+    for (const ImArray<float> &kernel : {general, separable, box})
+    {
+        const ImArray<float> expected = correlate_reference(x, kernel);
+
+        ImArray<float> out = ImArray<float>::Zero(x.rows(), x.cols());
+        correlate<float>(sparse_image, kernel, out);
+
+        EXPECT_TRUE(out.isApprox(expected, 1e-5f))
+            << static_cast<int>(classify_kernel<float>(kernel)) << "\n" << (out - expected).abs().maxCoeff();
+    } // end for kernel
+}
+
+TEST(SparseImage, correlate__nearly_separable_kernel)
+{
+    const ImArray<bool> x = random_mask(45, 60, 0.5f);
+    const SparseImage<bool> sparse_image(x);
+
+    // Off from rank one by a few parts per million, far more than rounding.
+    Eigen::Array<float, Dynamic, 1> column{{0.1f, 0.4f, 0.6f, 0.4f, 0.1f}};
+    Eigen::Array<float, 1, Dynamic> row{{0.25f, 0.5f, 0.25f}};
+    ImArray<float> kernel = column.matrix() * row.matrix();
+    kernel(0, 2) += 1.5e-6f;
+
+    EXPECT_EQ(classify_kernel<float>(kernel), KernelKind::GENERAL);
+
+    ImArray<float> out = ImArray<float>::Zero(x.rows(), x.cols());
+    correlate<float>(sparse_image, kernel, out);
+
+    const ImArray<double> expected = correlate_reference<double>(x, kernel.cast<double>());
+    EXPECT_LT((out.cast<double>() - expected).abs().maxCoeff(), 5e-7);
+}
+
+TEST(SparseImage, correlate__separable_row_passes)
+{
+    // Rows 3 and 9 hold one run each, too few for the two 1D passes to pay off.
+    // Row 6 alternates and holds 30 runs, which are spread with the row factor.
+    ImArray<bool> x = ImArray<bool>::Constant(12, 60, false);
+    x(3, 0) = true;
+    x.block(9, 20, 1, 25) = true;
+    for (Eigen::Index u = 0; u < x.cols(); u += 2) x(6, u) = true;
+
+    const SparseImage<bool> sparse_image(x);
+
+    Eigen::Array<int32_t, Dynamic, 1> column{{1, 4, 6, 4, 1}};
+    Eigen::Array<int32_t, 1, Dynamic> row{{1, 2, 3, 2, 1}};
+    ImArray<int32_t> kernel = column.matrix() * row.matrix();
+    ASSERT_EQ(classify_kernel<int32_t>(kernel), KernelKind::SEPARABLE);
+
+    const ImArray<int32_t> expected = correlate_reference(x, kernel);
+    for (Eigen::Index v : {3, 6, 9})
+    {
+        // Only the one input row
+        ImArray<bool> x_row = ImArray<bool>::Constant(x.rows(), x.cols(), false);
+        x_row.row(v) = x.row(v);
+
+        ImArray<int32_t> out = ImArray<int32_t>::Zero(x.rows(), x.cols());
+        correlate<int32_t>(SparseImage<bool>(x_row), kernel, out);
+        EXPECT_TRUE((out == correlate_reference(x_row, kernel)).all()) << v;
+    } // end for v
+
+    ImArray<int32_t> out = ImArray<int32_t>::Zero(x.rows(), x.cols());
+    correlate<int32_t>(sparse_image, kernel, out);
+    EXPECT_TRUE((out == expected).all());
+
+    ImArray<float> float_out = ImArray<float>::Zero(x.rows(), x.cols());
+    correlate<float>(sparse_image, ImArray<float>(kernel.cast<float>()), float_out);
+    EXPECT_TRUE((float_out == expected.cast<float>()).all());
+}
+
+TEST(SparseImage, correlate__integer_kernels)
+{
+    const ImArray<bool> x = random_mask(40, 55, 0.2f);
+    const SparseImage<bool> sparse_image(x);
+
+    ImArray<int32_t> general
+    {
+        {0, 1, 0},
+        {1, -4, 1},
+        {0, 1, 0},
+    };
+    ImArray<int32_t> separable
+    {
+        {1, 2, 1},
+        {2, 4, 2},
+        {1, 2, 1},
+    };
+    ImArray<int32_t> box = ImArray<int32_t>::Constant(1, 5, 3);
+
+    for (const ImArray<int32_t> &kernel : {general, separable, box})
+    {
+        ImArray<int32_t> out = ImArray<int32_t>::Zero(x.rows(), x.cols());
+        correlate<int32_t>(sparse_image, kernel, out);
+
+        EXPECT_TRUE((out == correlate_reference(x, kernel)).all())
+            << static_cast<int>(classify_kernel<int32_t>(kernel));
+    } // end for kernel
+}
+
+TEST(SparseImage, correlate__kernel_larger_than_image)
+{
+    const ImArray<bool> x = random_mask(4, 6, 0.3f);
+    const SparseImage<bool> sparse_image(x);
+
+    const ImArray<float> kernel = ImArray<float>::Random(11, 13);
+    ImArray<float> out = ImArray<float>::Zero(x.rows(), x.cols());
+    correlate<float>(sparse_image, kernel, out);
+
+    EXPECT_TRUE(out.isApprox(correlate_reference(x, kernel), 1e-5f));
+}
+
+TEST(SparseImage, correlate_rows)
+{
+    const ImArray<bool> x = random_mask(50, 30, 0.5f);
+    const SparseImage<bool> sparse_image(x);
+
+    const ImArray<float> kernel = ImArray<float>::Random(7, 5);
+    const ImArray<float> expected = correlate_reference(x, kernel);
+
+    for (KernelKind kind : {KernelKind::GENERAL, classify_kernel<float>(kernel)})
+    {
+        ImArray<float> out = ImArray<float>::Constant(x.rows(), x.cols(), 1.0f);
+        correlate_rows<float>(sparse_image, kernel, kind, 10, 23, out);
+
+        EXPECT_TRUE((out.topRows(10) == 1.0f).all());
+        EXPECT_TRUE((out.bottomRows(27) == 1.0f).all());
+        EXPECT_TRUE((out.middleRows(10, 13) - 1.0f).isApprox(expected.middleRows(10, 13), 1e-5f));
+    } // end for kind
+}
+
+TEST(SparseImage, correlate__thread_pool)
+{
+    const ImArray<bool> x = random_mask(203, 71, 0.5f);
+
+    // Without a row index, which correlate() builds once for all bands.
+    const SparseImage<bool> sparse_image(x);
+
+    ImArray<float> general = ImArray<float>::Random(7, 5);
+    ImArray<float> box = ImArray<float>::Constant(5, 5, 0.5f);
+
+    codec::ThreadPool pool(3);
+    for (const ImArray<float> &kernel : {general, box})
+    {
+        ImArray<float> expected = ImArray<float>::Zero(x.rows(), x.cols());
+        correlate<float>(sparse_image, kernel, expected);
+
+        ImArray<float> out = ImArray<float>::Zero(x.rows(), x.cols());
+        correlate<float>(sparse_image, kernel, out, &pool);
+
+        EXPECT_TRUE((out == expected).all());
+    } // end for kernel
+
+    // Too few rows to split
+    ImArray<float> tall_kernel = ImArray<float>::Random(61, 3);
+    ImArray<float> expected = ImArray<float>::Zero(x.rows(), x.cols());
+    correlate<float>(sparse_image, tall_kernel, expected);
+
+    ImArray<float> out = ImArray<float>::Zero(x.rows(), x.cols());
+    correlate<float>(sparse_image, tall_kernel, out, &pool);
+    EXPECT_TRUE((out == expected).all());
+
+    EXPECT_FALSE(sparse_image.has_row_index());
+
+    // The image's own row index is used when it has one.
+    SparseImage<bool> indexed_image(x);
+    indexed_image.build_row_index(5);
+    out.setZero();
+    correlate<float>(indexed_image, general, out, &pool);
+    expected.setZero();
+    correlate<float>(sparse_image, general, expected);
+    EXPECT_TRUE((out == expected).all());
+}
+
 TEST(SparseImage, CWiseBinaryOp)
 {
     ImArray<bool> a
@@ -236,4 +762,55 @@ TEST(SparseImage, CWiseOp)
         << out_lhs_sparse;
     EXPECT_TRUE((out_rhs_sparse == out_expected).all()) 
         << out_rhs_sparse; 
+
+    ImArray<bool> out_sparse(3, 4);
+    from_sparse_image<bool>(operation_both_sparse.eval_sparse(), out_sparse);
+    EXPECT_TRUE((out_sparse == out_expected).all())
+        << out_sparse;
+}
+
+TEST(SparseImage, combine)
+{
+    ImArray<bool> a = random_mask(37, 53, 0.3f);
+    ImArray<bool> b = random_mask(37, 53, 0.6f);
+    a(0, 0) = true;
+    b(36, 52) = true;
+    a.row(5) = false;
+    b.row(5) = true;
+
+    const SparseImage<bool> sparse_a(a);
+    const SparseImage<bool> sparse_b(b);
+    ImArray<bool> out(a.rows(), a.cols());
+
+    from_sparse_image<bool>(combine(sparse_a, sparse_b, ops::binary::boolean::And()), out);
+    EXPECT_TRUE((out == (a && b)).all());
+
+    from_sparse_image<bool>(combine(sparse_a, sparse_b, ops::binary::boolean::Or()), out);
+    EXPECT_TRUE((out == (a || b)).all());
+
+    from_sparse_image<bool>(combine(sparse_a, sparse_b, ops::binary::boolean::Xor()), out);
+    EXPECT_TRUE((out == (a != b)).all());
+
+    from_sparse_image<bool>(combine(sparse_a, sparse_b, ops::binary::boolean::AndNot()), out);
+    EXPECT_TRUE((out == (a && !b)).all());
+
+    // The result is encoded exactly like the mask it stands for
+    const SparseImage<bool> sparse_xor = combine(sparse_a, sparse_b, ops::binary::boolean::Xor());
+    const SparseImage<bool> expected_xor(ImArray<bool>(a != b));
+    EXPECT_THAT(sparse_xor.encoded_runs(), ::testing::ElementsAreArray(expected_xor.encoded_runs()));
+}
+
+TEST(SparseImage, combine__empty_and_full)
+{
+    const ImArray<bool> zeros = ImArray<bool>::Constant(3, 4, false);
+    const ImArray<bool> ones = ImArray<bool>::Constant(3, 4, true);
+    const SparseImage<bool> sparse_zeros(zeros);
+    const SparseImage<bool> sparse_ones(ones);
+
+    ImArray<bool> out(3, 4);
+    from_sparse_image<bool>(combine(sparse_zeros, sparse_ones, ops::binary::boolean::Or()), out);
+    EXPECT_TRUE(out.all());
+
+    from_sparse_image<bool>(combine(sparse_ones, sparse_ones, ops::binary::boolean::AndNot()), out);
+    EXPECT_FALSE(out.any());
 }
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include "codec/bit_packed.h"
+#include "imgproc/common.h"
+#include "imgproc/sparse_image.h"
+#include <Eigen/Dense>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+// Packs a byte mask into 64-bit words, one padded row of
+// codec::bit_packed::row_stride(x.cols()) words per row.
+inline std::vector<uint64_t> pack(const Eigen::Array<uint8_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> &x)
+{
+    const size_t stride = codec::bit_packed::row_stride(x.cols());
+    std::vector<uint64_t> words(stride * x.rows());
+    for (Eigen::Index v = 0; v < x.rows(); v++)
+    for (Eigen::Index u = 0; u < x.cols(); u++)
+    {
+        if (x(v, u))
+        {
+            words[v * stride + u / 64] |= uint64_t(1) << (u % 64);
+        }
+    }
+    return words;
+}
+
+// Uniform noise with a fraction of about (1 - threshold) / 2 ones, plus a
+// solid block of ones over the middle half of the rows and columns.
+inline ImArray<bool> random_mask(Eigen::Index rows, Eigen::Index cols, float threshold)
+{
+    ImArray<float> rand_x = ImArray<float>::Random(rows, cols);
+    ImArray<bool> x = rand_x > threshold;
+    x.block(rows / 4, cols / 4, rows / 2, cols / 2) = true;
+    return x;
+}
+
+// Decodes a whole sparse mask.
+inline ImArray<bool> to_dense(const SparseImage<bool> &image)
+{
+    ImArray<bool> x(image.height(), image.width());
+    x.setConstant(0);
+    from_sparse_image<bool>(image, x);
+    return x;
+}
+
+// A path in the temp directory that is unique to the running test, so test
+// processes run in parallel by ctest do not share files.
+inline std::filesystem::path unique_temp_path(const std::string &prefix)
+{
+    const ::testing::UnitTest *unit_test = ::testing::UnitTest::GetInstance();
+    return std::filesystem::temp_directory_path() /
+        (prefix + "_" + std::to_string(unit_test->random_seed()) + "_" + unit_test->current_test_info()->name());
+}
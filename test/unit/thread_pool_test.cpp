@@ -0,0 +1,43 @@
+#include "codec/thread_pool.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using codec::ThreadPool;
+
+TEST(ThreadPool, parallel_for)
+{
+    ThreadPool pool(4);
+
+    std::vector<int> visited(1000);
+    pool.parallel_for(visited.size(), [&](size_t i) { visited[i] += 1; });
+
+    for (const int count : visited)
+    {
+        EXPECT_EQ(count, 1);
+    }
+}
+
+TEST(ThreadPool, parallel_for__nested)
+{
+    ThreadPool pool(2);
+
+    std::atomic<int> count{0};
+    pool.parallel_for(8, [&](size_t) {
+        pool.parallel_for(8, [&](size_t) { ++count; });
+    });
+
+    EXPECT_EQ(count, 64);
+}
+
+TEST(ThreadPool, parallel_for__exception)
+{
+    ThreadPool pool(2);
+
+    EXPECT_THROW(
+        pool.parallel_for(100, [](size_t i) {
+            if (50 == i) throw std::runtime_error("error");
+        }),
+        std::runtime_error);
+}